@@ -0,0 +1,1044 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_libft.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../libft.h"
+#include "libft_ext.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Color codes for output
+#define GREEN "\033[32m"
+#define RED "\033[31m"
+#define BLUE "\033[34m"
+#define YELLOW "\033[33m"
+#define RESET "\033[0m"
+
+// Number of runs per measurement (the fastest one is reported)
+#define BENCH_REPEAT 5
+
+#define MIB (1024.0 * 1024.0)
+
+// Allocation counters, updated by the malloc wrapper below
+static size_t malloc_calls = 0;
+static size_t malloc_bytes = 0;
+
+// Keeps the compiler from optimizing benchmarked calls away
+static volatile size_t bench_sink;
+
+// Result of one benchmark: best time of BENCH_REPEAT runs, allocations per run
+typedef struct s_bench_result
+{
+    double seconds;
+    size_t allocs;
+    size_t alloc_bytes;
+} t_bench_result;
+
+// The bench binary is linked with -Wl,--wrap=malloc so that every malloc
+// call made by libft (and by this file) goes through here and is counted
+void *__real_malloc(size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    malloc_calls++;
+    malloc_bytes += size;
+    return __real_malloc(size);
+}
+
+// now_seconds and rss_mib are copied in test_libft.c for the soak profile;
+// keep them in sync
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Runs fn(arg) repeat times and keeps the fastest run
+static t_bench_result bench_run_n(void (*fn)(void *), void *arg, int repeat)
+{
+    t_bench_result result = {0, 0, 0};
+    size_t calls = malloc_calls;
+    size_t bytes = malloc_bytes;
+
+    for (int i = 0; i < repeat; i++)
+    {
+        double start = now_seconds();
+        fn(arg);
+        double elapsed = now_seconds() - start;
+        if (i == 0 || elapsed < result.seconds)
+            result.seconds = elapsed;
+    }
+    result.allocs = (malloc_calls - calls) / repeat;
+    result.alloc_bytes = (malloc_bytes - bytes) / repeat;
+    return result;
+}
+
+// Runs fn(arg) BENCH_REPEAT times and keeps the fastest run
+static t_bench_result bench_run(void (*fn)(void *), void *arg)
+{
+    return bench_run_n(fn, arg, BENCH_REPEAT);
+}
+
+// Prints one result row; input_bytes is the amount of data processed per run
+static void print_result(const char *name, t_bench_result r, size_t input_bytes)
+{
+    printf("  %-28s %10.3f ms %10zu allocs %10.1f MiB alloc'd",
+           name, r.seconds * 1e3, r.allocs, r.alloc_bytes / MIB);
+    if (input_bytes)
+        printf(" %9.1f MB/s", input_bytes / r.seconds / 1e6);
+    printf("\n");
+}
+
+// Prints how much faster r is than base
+static void print_speedup(const char *name, t_bench_result base, t_bench_result r)
+{
+    const char *color = r.seconds <= base.seconds ? GREEN : RED;
+
+    printf("  %s→ %s: %.2fx faster, %ld fewer allocations" RESET "\n",
+           color, name, base.seconds / r.seconds,
+           (long)base.allocs - (long)r.allocs);
+}
+
+// Fills a buffer with len bytes of words made of [a-z] separated by sep
+static char *make_words(size_t len, char sep)
+{
+    char *buf = malloc(len + 1);
+    size_t i = 0;
+
+    if (!buf)
+        return NULL;
+    while (i < len)
+    {
+        size_t word = 1 + rand() % 12;
+        while (word-- && i < len)
+            buf[i++] = 'a' + rand() % 26;
+        if (i < len)
+            buf[i++] = sep;
+    }
+    buf[len] = '\0';
+    return buf;
+}
+
+// =============================================================================
+// FT_SPLIT BENCHMARKS
+// =============================================================================
+
+typedef struct s_split_arg
+{
+    const char *text;
+    char sep;
+} t_split_arg;
+
+static void run_ft_split(void *p)
+{
+    t_split_arg *arg = p;
+    char **words = ft_split(arg->text, arg->sep);
+    size_t n = 0;
+
+    if (!words)
+        return;
+    while (words[n])
+        free(words[n++]);
+    free(words);
+    bench_sink = n;
+}
+
+static void run_ft_split_next(void *p)
+{
+    t_split_arg *arg = p;
+    t_split_iter it;
+    const char *token;
+    size_t len;
+    size_t n = 0;
+
+    ft_split_iter_init(&it, arg->text, arg->sep);
+    while (ft_split_next(&it, &token, &len))
+        n++;
+    bench_sink = n;
+}
+
+// Time budget for one ft_split run: a quadratic ft_split (e.g. one that calls
+// ft_substr on the rest of the string) takes tens of seconds per MiB
+#define SPLIT_BUDGET 1.0
+
+void bench_ft_split(void)
+{
+    const size_t sizes[] = {1 << 20, 8 << 20};
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        t_split_arg arg = {make_words(sizes[i], ' '), ' '};
+        if (!arg.text)
+            return;
+        printf(BLUE "\n=== Benchmarking ft_split (%.0f MiB) ===\n" RESET, sizes[i] / MIB);
+
+        // One run first; only repeat it if it fits in the budget
+        t_bench_result split = bench_run_n(run_ft_split, &arg, 1);
+        if (split.seconds * BENCH_REPEAT <= SPLIT_BUDGET)
+            split = bench_run(run_ft_split, &arg);
+        print_result("ft_split + free", split, sizes[i]);
+        t_bench_result iter = bench_run(run_ft_split_next, &arg);
+        print_result("ft_split_next", iter, sizes[i]);
+        print_speedup("ft_split_next", split, iter);
+        free((char *)arg.text);
+        if (split.seconds > SPLIT_BUDGET && i + 1 < sizeof(sizes) / sizeof(sizes[0]))
+        {
+            printf(YELLOW "  ft_split took over %.0f s, skipping larger inputs" RESET "\n", SPLIT_BUDGET);
+            break;
+        }
+    }
+}
+
+// =============================================================================
+// FT_STRNSTR BENCHMARKS
+// =============================================================================
+
+typedef struct s_strnstr_arg
+{
+    const char *haystack;
+    const char *needle;
+    size_t len;
+} t_strnstr_arg;
+
+static void run_ft_strnstr(void *p)
+{
+    t_strnstr_arg *arg = p;
+
+    bench_sink = (size_t)ft_strnstr(arg->haystack, arg->needle, arg->len);
+}
+
+static void run_ft_strnstr_fast(void *p)
+{
+    t_strnstr_arg *arg = p;
+
+    bench_sink = (size_t)ft_strnstr_fast(arg->haystack, arg->needle, arg->len);
+}
+
+static void run_libc_strstr(void *p)
+{
+    t_strnstr_arg *arg = p;
+
+    bench_sink = (size_t)strstr(arg->haystack, arg->needle);
+}
+
+// Compares ft_strnstr, ft_strnstr_fast and libc strstr on one case
+static void bench_strnstr_case(const char *title, const char *haystack, const char *needle)
+{
+    t_strnstr_arg arg = {haystack, needle, strlen(haystack)};
+    // The naive search is quadratic on the worst cases: one run is enough there
+    int repeat = strlen(needle) >= 256 ? 1 : BENCH_REPEAT;
+
+    printf(BLUE "\n=== Benchmarking ft_strnstr (%s, needle %zu chars) ===\n" RESET,
+           title, strlen(needle));
+    t_bench_result naive = bench_run_n(run_ft_strnstr, &arg, repeat);
+    print_result("ft_strnstr", naive, arg.len);
+    t_bench_result fast = bench_run(run_ft_strnstr_fast, &arg);
+    print_result("ft_strnstr_fast", fast, arg.len);
+    t_bench_result libc = bench_run(run_libc_strstr, &arg);
+    print_result("strstr (libc)", libc, arg.len);
+    print_speedup("ft_strnstr_fast", naive, fast);
+}
+
+// Fills buf with len chars repeating pattern
+static void fill_pattern(char *buf, size_t len, const char *pattern)
+{
+    size_t plen = strlen(pattern);
+
+    for (size_t i = 0; i < len; i++)
+        buf[i] = pattern[i % plen];
+    buf[len] = '\0';
+}
+
+void bench_ft_strnstr(void)
+{
+    const size_t hay_len = 1 << 20;
+    const size_t needle_lens[] = {16, 256, 4096};
+    char *haystack = malloc(hay_len + 1);
+    char *needle = malloc(4096 + 1);
+
+    if (!haystack || !needle)
+        return;
+    // Worst case for a naive search: "aaaa...a" searched for "aaa...ab"
+    fill_pattern(haystack, hay_len, "a");
+    for (size_t i = 0; i < sizeof(needle_lens) / sizeof(needle_lens[0]); i++)
+    {
+        fill_pattern(needle, needle_lens[i] - 1, "a");
+        strcpy(needle + needle_lens[i] - 1, "b");
+        bench_strnstr_case("\"aaaa...\" for \"aaa...ab\"", haystack, needle);
+    }
+    // Periodic worst case: "abab..." searched for "abab...abb"
+    fill_pattern(haystack, hay_len, "ab");
+    fill_pattern(needle, 254, "ab");
+    strcpy(needle + 254, "b");
+    bench_strnstr_case("\"abab...\" for \"abab...abb\"", haystack, needle);
+    // Typical case: random words, needle absent
+    free(haystack);
+    haystack = make_words(hay_len, ' ');
+    if (haystack)
+        bench_strnstr_case("random words, no match", haystack, "zzzzzzzzzzzzzzzz");
+    free(haystack);
+    free(needle);
+}
+
+// =============================================================================
+// FT_MEMMOVE BENCHMARKS
+// =============================================================================
+
+// Bytes moved per measurement; small moves are repeated up to this amount
+#define MOVE_BYTES (64 << 20)
+#define MOVE_DIST 64
+
+// Moves len bytes by dist inside buf, iters times. dist > 0 moves towards
+// higher addresses (an overlapping ft_memmove has to copy backwards),
+// dist < 0 towards lower addresses (it can copy forwards).
+typedef struct s_move_arg
+{
+    unsigned char *buf;
+    size_t len;
+    long dist;
+    size_t iters;
+} t_move_arg;
+
+static void run_ft_memmove(void *p)
+{
+    t_move_arg *arg = p;
+    unsigned char *src = arg->buf + MOVE_DIST;
+
+    for (size_t i = 0; i < arg->iters; i++)
+        ft_memmove(src + arg->dist, src, arg->len);
+    bench_sink = src[0];
+}
+
+static void run_libc_memmove(void *p)
+{
+    t_move_arg *arg = p;
+    unsigned char *src = arg->buf + MOVE_DIST;
+
+    for (size_t i = 0; i < arg->iters; i++)
+        memmove(src + arg->dist, src, arg->len);
+    bench_sink = src[0];
+}
+
+void bench_ft_memmove(void)
+{
+    const size_t sizes[] = {64, 4096, 1 << 20, 16 << 20};
+    const long dists[] = {-MOVE_DIST, MOVE_DIST};
+    const char *titles[] = {"dst before src, forward copy", "dst after src, backward copy"};
+    unsigned char *buf = malloc((16 << 20) + 2 * MOVE_DIST);
+
+    if (!buf)
+        return;
+    memset(buf, 'x', (16 << 20) + 2 * MOVE_DIST);
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        for (size_t d = 0; d < 2; d++)
+        {
+            t_move_arg arg = {buf, sizes[i], dists[d], MOVE_BYTES / sizes[i]};
+            printf(BLUE "\n=== Benchmarking ft_memmove (%zu bytes x %zu, %s) ===\n" RESET,
+                   arg.len, arg.iters, titles[d]);
+            t_bench_result ft = bench_run(run_ft_memmove, &arg);
+            print_result("ft_memmove", ft, MOVE_BYTES);
+            t_bench_result libc = bench_run(run_libc_memmove, &arg);
+            print_result("memmove (libc)", libc, MOVE_BYTES);
+            print_speedup("memmove (libc)", ft, libc);
+        }
+    }
+    free(buf);
+}
+
+// =============================================================================
+// FT_CALLOC BENCHMARKS
+// =============================================================================
+
+// alloc(size, 1), then free
+typedef struct s_calloc_arg
+{
+    void *(*alloc)(size_t, size_t);
+    size_t size;
+} t_calloc_arg;
+
+// Resident set size in MiB, from /proc/self/statm (0 if unavailable)
+static double rss_mib(void)
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    unsigned long size = 0;
+    unsigned long resident = 0;
+
+    if (!statm)
+        return 0;
+    if (fscanf(statm, "%lu %lu", &size, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * (double)sysconf(_SC_PAGESIZE) / MIB;
+}
+
+static void run_calloc(void *p)
+{
+    t_calloc_arg *arg = p;
+    unsigned char *buf = arg->alloc(arg->size, 1);
+
+    bench_sink = buf ? buf[arg->size / 2] : 0;
+    free(buf);
+}
+
+// RSS growth caused by one allocation, measured outside the timed runs
+static double calloc_rss(t_calloc_arg *arg)
+{
+    double rss = rss_mib();
+    unsigned char *buf = arg->alloc(arg->size, 1);
+    double grown = rss_mib() - rss;
+
+    bench_sink = buf ? buf[arg->size / 2] : 0;
+    free(buf);
+    return grown;
+}
+
+static void print_calloc_result(const char *name, t_bench_result r, double rss)
+{
+    printf("  %-28s %10.3f ms %10.1f MiB resident after the call\n",
+           name, r.seconds * 1e3, rss);
+}
+
+// libc calloc gets fresh pages from mmap that the kernel already zeroed and
+// only maps on first write, so neither the time nor the RSS grow with the
+// size. An ft_calloc built on malloc + ft_bzero writes, and so maps, every
+// page before returning. 1 MiB blocks usually come from the heap after the
+// first free, where libc has to clear them too.
+void bench_ft_calloc(void)
+{
+    const size_t sizes[] = {1 << 20, 64 << 20, (size_t)1 << 30};
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        t_calloc_arg ft = {ft_calloc, sizes[i]};
+        t_calloc_arg libc = {calloc, sizes[i]};
+
+        printf(BLUE "\n=== Benchmarking ft_calloc (%.0f MiB) ===\n" RESET, sizes[i] / MIB);
+        t_bench_result ft_r = bench_run(run_calloc, &ft);
+        double ft_rss = calloc_rss(&ft);
+        print_calloc_result("ft_calloc + free", ft_r, ft_rss);
+        t_bench_result libc_r = bench_run(run_calloc, &libc);
+        double libc_rss = calloc_rss(&libc);
+        print_calloc_result("calloc (libc) + free", libc_r, libc_rss);
+        printf("  %s→ calloc (libc): %.2fx faster, %.1f MiB less resident" RESET "\n",
+               libc_r.seconds <= ft_r.seconds ? GREEN : RED,
+               ft_r.seconds / libc_r.seconds, ft_rss - libc_rss);
+    }
+}
+
+// =============================================================================
+// FT_SUBSTR / FT_STRTRIM BENCHMARKS
+// =============================================================================
+
+#define FIELD_LEN 16
+#define LINE_FIELDS 4
+#define LINE_LEN (FIELD_LEN * LINE_FIELDS)
+
+// count NUL-terminated strings of len chars each, stored back to back
+typedef struct s_strings_arg
+{
+    char *buf;
+    size_t count;
+    size_t len;
+} t_strings_arg;
+
+// Lines of LINE_LEN chars, cut into LINE_FIELDS fixed-width fields
+static t_strings_arg make_lines(size_t count)
+{
+    t_strings_arg arg = {malloc(count * (LINE_LEN + 1)), count, LINE_LEN};
+
+    for (size_t i = 0; arg.buf && i < count; i++)
+    {
+        char *line = arg.buf + i * (LINE_LEN + 1);
+        for (size_t j = 0; j < LINE_LEN; j++)
+            line[j] = 'a' + rand() % 26;
+        line[LINE_LEN] = '\0';
+    }
+    return arg;
+}
+
+// Fields of FIELD_LEN chars, a word padded with spaces and tabs on both sides
+static t_strings_arg make_padded_fields(size_t count)
+{
+    t_strings_arg arg = {malloc(count * (FIELD_LEN + 1)), count, FIELD_LEN};
+
+    for (size_t i = 0; arg.buf && i < count; i++)
+    {
+        char *field = arg.buf + i * (FIELD_LEN + 1);
+        size_t left = rand() % 5;
+        size_t right = rand() % 5;
+        for (size_t j = 0; j < FIELD_LEN; j++)
+            field[j] = (j < left || j >= FIELD_LEN - right) ? " \t"[rand() % 2] : 'a' + rand() % 26;
+        field[FIELD_LEN] = '\0';
+    }
+    return arg;
+}
+
+static void run_ft_substr(void *p)
+{
+    t_strings_arg *arg = p;
+    size_t total = 0;
+
+    for (size_t i = 0; i < arg->count; i++)
+    {
+        const char *line = arg->buf + i * (arg->len + 1);
+        for (unsigned int f = 0; f < LINE_FIELDS; f++)
+        {
+            char *field = ft_substr(line, f * FIELD_LEN, FIELD_LEN);
+            total += field[0];
+            free(field);
+        }
+    }
+    bench_sink = total;
+}
+
+static void run_ft_substr_view(void *p)
+{
+    t_strings_arg *arg = p;
+    size_t total = 0;
+
+    for (size_t i = 0; i < arg->count; i++)
+    {
+        const char *line = arg->buf + i * (arg->len + 1);
+        for (unsigned int f = 0; f < LINE_FIELDS; f++)
+            total += ft_substr_view(line, f * FIELD_LEN, FIELD_LEN).ptr[0];
+    }
+    bench_sink = total;
+}
+
+void bench_ft_substr(void)
+{
+    t_strings_arg arg = make_lines(1 << 18);
+
+    if (!arg.buf)
+        return;
+    printf(BLUE "\n=== Benchmarking ft_substr (%zu lines, %d fields each) ===\n" RESET,
+           arg.count, LINE_FIELDS);
+    t_bench_result substr = bench_run(run_ft_substr, &arg);
+    print_result("ft_substr + free", substr, arg.count * LINE_LEN);
+    t_bench_result view = bench_run(run_ft_substr_view, &arg);
+    print_result("ft_substr_view", view, arg.count * LINE_LEN);
+    print_speedup("ft_substr_view", substr, view);
+    free(arg.buf);
+}
+
+static void run_ft_strtrim(void *p)
+{
+    t_strings_arg *arg = p;
+    size_t total = 0;
+
+    for (size_t i = 0; i < arg->count; i++)
+    {
+        char *trimmed = ft_strtrim(arg->buf + i * (arg->len + 1), " \t");
+        total += ft_strlen(trimmed);
+        free(trimmed);
+    }
+    bench_sink = total;
+}
+
+static void run_ft_strtrim_view(void *p)
+{
+    t_strings_arg *arg = p;
+    size_t total = 0;
+
+    for (size_t i = 0; i < arg->count; i++)
+        total += ft_strtrim_view(arg->buf + i * (arg->len + 1), " \t").len;
+    bench_sink = total;
+}
+
+void bench_ft_strtrim(void)
+{
+    t_strings_arg arg = make_padded_fields(1 << 20);
+
+    if (!arg.buf)
+        return;
+    printf(BLUE "\n=== Benchmarking ft_strtrim (%zu padded fields) ===\n" RESET, arg.count);
+    t_bench_result trim = bench_run(run_ft_strtrim, &arg);
+    print_result("ft_strtrim + free", trim, arg.count * FIELD_LEN);
+    t_bench_result view = bench_run(run_ft_strtrim_view, &arg);
+    print_result("ft_strtrim_view", view, arg.count * FIELD_LEN);
+    print_speedup("ft_strtrim_view", trim, view);
+    free(arg.buf);
+}
+
+// =============================================================================
+// FT_STRJOIN BENCHMARKS
+// =============================================================================
+
+#define FRAGMENT_LEN 8
+
+typedef struct s_join_arg
+{
+    const char **parts;
+    size_t count;
+} t_join_arg;
+
+// The usual way of building a string: result = ft_strjoin(result, part)
+static void run_chained_ft_strjoin(void *p)
+{
+    t_join_arg *arg = p;
+    char *result = ft_strdup("");
+
+    for (size_t i = 0; result && i < arg->count; i++)
+    {
+        char *next = ft_strjoin(result, arg->parts[i]);
+        free(result);
+        result = next;
+    }
+    bench_sink = result ? (size_t)result[0] : 0;
+    free(result);
+}
+
+static void run_ft_strjoin_all(void *p)
+{
+    t_join_arg *arg = p;
+    char *result = ft_strjoin_all(arg->parts, arg->count, NULL);
+
+    bench_sink = result ? (size_t)result[0] : 0;
+    free(result);
+}
+
+void bench_ft_strjoin(void)
+{
+    const size_t max_count = 100000;
+    char *text = make_words(max_count * FRAGMENT_LEN, 'x');
+    t_join_arg arg = {malloc(max_count * sizeof(char *)), 0};
+
+    if (!text || !arg.parts)
+        return;
+    // Fragments of FRAGMENT_LEN - 1 chars, cut from one buffer
+    for (size_t i = 0; i < max_count; i++)
+    {
+        text[i * FRAGMENT_LEN + FRAGMENT_LEN - 1] = '\0';
+        arg.parts[i] = text + i * FRAGMENT_LEN;
+    }
+    for (arg.count = 10; arg.count <= max_count; arg.count *= 10)
+    {
+        printf(BLUE "\n=== Benchmarking ft_strjoin (%zu fragments) ===\n" RESET, arg.count);
+        // Chained joins are quadratic: a single run is enough for large counts
+        t_bench_result chained = bench_run_n(run_chained_ft_strjoin, &arg,
+                                             arg.count >= 10000 ? 1 : BENCH_REPEAT);
+        print_result("chained ft_strjoin", chained, arg.count * (FRAGMENT_LEN - 1));
+        t_bench_result all = bench_run(run_ft_strjoin_all, &arg);
+        print_result("ft_strjoin_all", all, arg.count * (FRAGMENT_LEN - 1));
+        print_speedup("ft_strjoin_all", chained, all);
+    }
+    free(arg.parts);
+    free(text);
+}
+
+// =============================================================================
+// CORPUS MODE
+// =============================================================================
+
+#define CORPUS_NEEDLES 8
+#define CORPUS_FIELD_SEPS ",\t"
+#define CORPUS_TRIM_SET " \t\r"
+
+// A file mapped read-only, followed by at least one zero byte
+typedef struct s_corpus
+{
+    const char *path;
+    char *data;
+    size_t size;
+    size_t map_size;
+} t_corpus;
+
+// One line of the corpus report
+typedef struct s_corpus_result
+{
+    double ft_seconds;
+    double libc_seconds;
+    size_t count;
+    int ok;
+} t_corpus_result;
+
+// Maps path without copying it. The file is mapped over an anonymous
+// mapping one page larger, so data[size] is always a readable '\0' and the
+// string functions can run on the mapping directly.
+static int corpus_map(t_corpus *corpus, const char *path)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    corpus->path = path;
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
+    corpus->size = st.st_size;
+    corpus->map_size = (corpus->size + page - 1) / page * page + page;
+    corpus->data = mmap(NULL, corpus->map_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (corpus->data != MAP_FAILED && corpus->size > 0 &&
+        mmap(corpus->data, corpus->size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(corpus->data, corpus->map_size);
+        corpus->data = MAP_FAILED;
+    }
+    close(fd);
+    if (corpus->data == MAP_FAILED)
+        return 0;
+    madvise(corpus->data, corpus->map_size, MADV_SEQUENTIAL);
+    return 1;
+}
+
+static void print_corpus_result(const char *name, t_corpus_result r, size_t size)
+{
+    printf("  %s%s " RESET "%-28s %10zu", r.ok ? GREEN : RED, r.ok ? "✓" : "✗", name, r.count);
+    if (size == 0 || r.ft_seconds <= 0)
+    {
+        printf(" %14s\n", "-");
+        return;
+    }
+    printf(" %9.2f GB/s", size / r.ft_seconds / 1e9);
+    if (r.libc_seconds > 0)
+        printf("   (libc %.2f GB/s)", size / r.libc_seconds / 1e9);
+    printf("\n");
+}
+
+// --- ft_memchr: count the lines of the whole file -----------------------------
+
+static size_t count_bytes(void *(*find)(const void *, int, size_t), const t_corpus *corpus)
+{
+    const char *p = corpus->data;
+    const char *end = corpus->data + corpus->size;
+    size_t n = 0;
+
+    while (p < end && (p = find(p, '\n', end - p)))
+    {
+        n++;
+        p++;
+    }
+    return n;
+}
+
+static t_corpus_result corpus_memchr(const t_corpus *corpus)
+{
+    t_corpus_result r = {0, 0, 0, 0};
+    double start = now_seconds();
+
+    r.count = count_bytes(ft_memchr, corpus);
+    r.ft_seconds = now_seconds() - start;
+    start = now_seconds();
+    r.ok = count_bytes(memchr, corpus) == r.count;
+    r.libc_seconds = now_seconds() - start;
+    return r;
+}
+
+// --- ft_strnstr: find every occurrence of needles taken from the file ---------
+
+// strstr is the libc reference: the corpus ends with '\0', so it never
+// reads past len = end - haystack either
+static char *libc_strnstr(const char *haystack, const char *needle, size_t len)
+{
+    (void)len;
+    return strstr(haystack, needle);
+}
+
+// Returns the sum of match offsets (+1 each) so both count and positions are compared
+static size_t find_all(char *(*find)(const char *, const char *, size_t),
+                       const t_corpus *corpus, const char *needle, size_t *count)
+{
+    const char *p = corpus->data;
+    const char *end = corpus->data + corpus->size;
+    size_t sum = 0;
+
+    while (p < end)
+    {
+        const char *match = find(p, needle, end - p);
+        if (match)
+        {
+            (*count)++;
+            sum += match - corpus->data + 1;
+            p = match + 1;
+        }
+        else
+            p += strlen(p) + 1; // skip past an embedded '\0' (binary data)
+    }
+    return sum;
+}
+
+// Picks needles of 4 to 16 bytes at random offsets, plus one absent needle
+static int pick_needles(const t_corpus *corpus, char needles[CORPUS_NEEDLES][17])
+{
+    int n = 0;
+
+    for (int tries = 0; n < CORPUS_NEEDLES - 1 && tries < 1000 && corpus->size > 0; tries++)
+    {
+        size_t offset = ((size_t)rand() * RAND_MAX + rand()) % corpus->size;
+        size_t len = 4 + rand() % 13;
+        size_t i = 0;
+        while (i < len && offset + i < corpus->size && corpus->data[offset + i] &&
+               corpus->data[offset + i] != '\n')
+        {
+            needles[n][i] = corpus->data[offset + i];
+            i++;
+        }
+        needles[n][i] = '\0';
+        if (i >= 4)
+            n++;
+    }
+    strcpy(needles[n++], "\x01libft-absent\x02");
+    return n;
+}
+
+static t_corpus_result corpus_strnstr(const t_corpus *corpus)
+{
+    t_corpus_result r = {0, 0, 0, 1};
+    char needles[CORPUS_NEEDLES][17];
+    int n = pick_needles(corpus, needles);
+
+    for (int i = 0; i < n; i++)
+    {
+        size_t ft_count = 0;
+        size_t libc_count = 0;
+        double start = now_seconds();
+        size_t ft_sum = find_all(ft_strnstr, corpus, needles[i], &ft_count);
+        r.ft_seconds += now_seconds() - start;
+        start = now_seconds();
+        size_t libc_sum = find_all(libc_strnstr, corpus, needles[i], &libc_count);
+        r.libc_seconds += now_seconds() - start;
+        r.ok &= ft_sum == libc_sum && ft_count == libc_count;
+        r.count += ft_count;
+    }
+    // Throughput is reported per needle
+    r.ft_seconds /= n;
+    r.libc_seconds /= n;
+    return r;
+}
+
+// --- ft_split: split every '\0'-free segment of the file into lines -----------
+
+static int lines_match(const char *segment, char **lines)
+{
+    const char *p = segment;
+    size_t i = 0;
+
+    while (*p)
+    {
+        p += strspn(p, "\n");
+        if (!*p)
+            break;
+        size_t len = strcspn(p, "\n");
+        if (!lines[i] || strlen(lines[i]) != len || memcmp(lines[i], p, len) != 0)
+            return 0;
+        i++;
+        p += len;
+    }
+    return lines[i] == NULL;
+}
+
+static t_corpus_result corpus_split(const t_corpus *corpus)
+{
+    t_corpus_result r = {0, 0, 0, 1};
+    const char *end = corpus->data + corpus->size;
+
+    for (const char *seg = corpus->data; seg < end; seg += strlen(seg) + 1)
+    {
+        double start = now_seconds();
+        char **lines = ft_split(seg, '\n');
+        r.ft_seconds += now_seconds() - start;
+        if (!lines)
+        {
+            r.ok = 0;
+            break;
+        }
+        r.ok &= lines_match(seg, lines);
+        start = now_seconds();
+        for (size_t i = 0; lines[i]; i++, r.count++)
+            free(lines[i]);
+        free(lines);
+        r.ft_seconds += now_seconds() - start;
+    }
+    return r;
+}
+
+// --- ft_strtrim: trim every ',' or '\t' separated field of every line ---------
+
+// Trims field with libc only and compares with ft_strtrim's result
+static int trim_matches(const char *field, const char *trimmed)
+{
+    size_t start = strspn(field, CORPUS_TRIM_SET);
+    size_t end = strlen(field);
+
+    while (end > start && strchr(CORPUS_TRIM_SET, field[end - 1]))
+        end--;
+    return trimmed && strlen(trimmed) == end - start &&
+           memcmp(trimmed, field + start, end - start) == 0;
+}
+
+// Fields end at '\n', CORPUS_FIELD_SEPS or an embedded '\0'. ft_strtrim
+// needs a '\0'-terminated field, so each one is copied to a scratch buffer
+// first; the copy is part of the measured time.
+// With verify set, results are checked against libc instead of timed.
+static size_t trim_fields(const t_corpus *corpus, int verify, int *ok)
+{
+    const char *p = corpus->data;
+    const char *end = corpus->data + corpus->size;
+    char *scratch = NULL;
+    size_t scratch_size = 0;
+    size_t n = 0;
+
+    while (p < end)
+    {
+        size_t len = 0;
+        while (p + len < end && p[len] != '\n' && !strchr(CORPUS_FIELD_SEPS, p[len]))
+            len++;
+        if (len + 1 > scratch_size)
+        {
+            free(scratch);
+            scratch_size = (len + 1) * 2;
+            scratch = malloc(scratch_size);
+            if (!scratch)
+            {
+                *ok = 0;
+                return n;
+            }
+        }
+        memcpy(scratch, p, len);
+        scratch[len] = '\0';
+        char *trimmed = ft_strtrim(scratch, CORPUS_TRIM_SET);
+        if (verify && !trim_matches(scratch, trimmed))
+            *ok = 0;
+        bench_sink += trimmed ? trimmed[0] : 0;
+        free(trimmed);
+        n++;
+        p += len + 1;
+    }
+    free(scratch);
+    return n;
+}
+
+static t_corpus_result corpus_strtrim(const t_corpus *corpus)
+{
+    t_corpus_result r = {0, 0, 0, 1};
+    double start = now_seconds();
+
+    r.count = trim_fields(corpus, 0, &r.ok);
+    r.ft_seconds = now_seconds() - start;
+    trim_fields(corpus, 1, &r.ok);
+    return r;
+}
+
+// Runs every corpus check on each file; returns 0 if all of them match libc
+int run_corpus(int count, char **paths)
+{
+    int ok = 1;
+
+    printf(YELLOW "=== LIBFT CORPUS MODE ===\n" RESET);
+    printf("Single pass per check, compared against libc\n");
+    srand(42);
+    for (int i = 0; i < count; i++)
+    {
+        t_corpus corpus;
+        if (!corpus_map(&corpus, paths[i]))
+        {
+            printf(RED "\n✗ Cannot map %s\n" RESET, paths[i]);
+            ok = 0;
+            continue;
+        }
+        printf(BLUE "\n=== Corpus: %s (%zu bytes, %.1f MiB) ===\n" RESET,
+               corpus.path, corpus.size, corpus.size / MIB);
+        printf("    %-28s %10s %14s\n", "Check", "Count", "Throughput");
+
+        t_corpus_result r = corpus_memchr(&corpus);
+        print_corpus_result("ft_memchr '\\n' scan", r, corpus.size);
+        ok &= r.ok;
+        r = corpus_strnstr(&corpus);
+        print_corpus_result("ft_strnstr (per needle)", r, corpus.size);
+        ok &= r.ok;
+        r = corpus_split(&corpus);
+        print_corpus_result("ft_split lines", r, corpus.size);
+        ok &= r.ok;
+        r = corpus_strtrim(&corpus);
+        print_corpus_result("ft_strtrim fields", r, corpus.size);
+        ok &= r.ok;
+        munmap(corpus.data, corpus.map_size);
+    }
+    printf("\n%s" RESET "\n", ok ? GREEN "✓ All corpus checks match libc" : RED "✗ Some corpus checks differ from libc");
+    return ok ? 0 : 1;
+}
+
+// =============================================================================
+// MAIN FUNCTION
+// =============================================================================
+
+typedef struct s_bench
+{
+    const char *name;
+    void (*fn)(void);
+} t_bench;
+
+static const t_bench benches[] = {
+    {"split", bench_ft_split},
+    {"substr", bench_ft_substr},
+    {"trim", bench_ft_strtrim},
+    {"join", bench_ft_strjoin},
+    {"strnstr", bench_ft_strnstr},
+    {"memmove", bench_ft_memmove},
+    {"calloc", bench_ft_calloc},
+};
+
+int main(int argc, char **argv)
+{
+    size_t count = sizeof(benches) / sizeof(benches[0]);
+
+    if (argc >= 2 && strcmp(argv[1], "--corpus") == 0)
+    {
+        if (argc < 3)
+        {
+            printf("Usage: %s --corpus <file>...\n", argv[0]);
+            return 1;
+        }
+        return run_corpus(argc - 2, argv + 2);
+    }
+    for (int j = 1; j < argc; j++)
+    {
+        size_t i = 0;
+        while (i < count && strcmp(argv[j], benches[i].name) != 0)
+            i++;
+        if (i == count)
+        {
+            printf(RED "Unknown benchmark: %s\n" RESET "Available:", argv[j]);
+            for (i = 0; i < count; i++)
+                printf(" %s", benches[i].name);
+            printf("\n");
+            return 1;
+        }
+    }
+
+    printf(YELLOW "=== LIBFT BENCHMARKS ===\n" RESET);
+    printf("Best of %d runs per measurement\n", BENCH_REPEAT);
+    srand(42);
+
+    // With arguments, only run the named benchmarks
+    for (size_t i = 0; i < count; i++)
+    {
+        int selected = argc < 2;
+        for (int j = 1; j < argc; j++)
+            if (strcmp(argv[j], benches[i].name) == 0)
+                selected = 1;
+        if (selected)
+            benches[i].fn();
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#!/bin/bash
+
+# Coverage report for libft
+# Usage: ./coverage_report.sh <object_dir> <min_lines> <min_branches> <sources...>
+#
+# Runs gcov on every libft source built with --coverage into <object_dir>
+# and prints one row per ft_*.c file with its line and branch coverage
+# (branches taken at least once). Files below <min_lines> or <min_branches>
+# percent are marked and listed with their uncovered lines and the lines
+# holding branches that were never taken. Annotated sources are kept in
+# cov_report/.
+# Exits with 1 if any file is below a threshold, 0 otherwise.
+
+OBJ_DIR="$1"
+MIN_LINES="$2"
+MIN_BRANCHES="$3"
+shift 3
+GCOV="${GCOV:-gcov}"
+REPORT_DIR="cov_report"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+BLUE='\033[0;34m'
+NC='\033[0m' # No Color
+
+rm -rf "$REPORT_DIR"
+mkdir -p "$REPORT_DIR"
+
+echo -e "${BLUE}=======================================${NC}"
+echo -e "${BLUE}          COVERAGE REPORT             ${NC}"
+echo -e "${BLUE}=======================================${NC}"
+printf "%-24s %16s %16s\n" "File" "Lines" "Branches"
+printf "%-24s %16s %16s\n" "----" "-----" "--------"
+
+FAILED=0
+DETAILS=""
+TOTAL_LINES=0
+TOTAL_LINES_HIT=0
+TOTAL_BRANCHES=0
+TOTAL_BRANCHES_HIT=0
+
+for src in "$@"; do
+    name=$(basename "$src")
+
+    # "lines_pct lines branches_pct branches" for this file
+    STATS=$($GCOV -b -o "$OBJ_DIR" "$src" 2>/dev/null | awk -v file="$name" '
+        /^File / { current = ($0 ~ "[/'"'"']" file "'"'"'$") }
+        current && /^Lines executed:/ { split($2, a, ":"); lp = a[2]; ln = $4 }
+        current && /^Taken at least once:/ { split($4, b, ":"); bp = b[2]; bn = $6 }
+        END { sub(/%/, "", lp); sub(/%/, "", bp); print lp + 0, ln + 0, bp + 0, bn + 0 }
+    ')
+    mv -f ./*.gcov "$REPORT_DIR"/ 2>/dev/null
+    read -r LINE_PCT LINES BRANCH_PCT BRANCHES <<< "$STATS"
+
+    TOTAL_LINES=$((TOTAL_LINES + LINES))
+    TOTAL_LINES_HIT=$(awk -v t="$TOTAL_LINES_HIT" -v p="$LINE_PCT" -v n="$LINES" \
+        'BEGIN { printf "%d", t + p * n / 100 + 0.5 }')
+    TOTAL_BRANCHES=$((TOTAL_BRANCHES + BRANCHES))
+    TOTAL_BRANCHES_HIT=$(awk -v t="$TOTAL_BRANCHES_HIT" -v p="$BRANCH_PCT" -v n="$BRANCHES" \
+        'BEGIN { printf "%d", t + p * n / 100 + 0.5 }')
+
+    if [ "$BRANCHES" -eq 0 ]; then
+        BRANCH_COL="-"
+    else
+        BRANCH_COL=$(printf "%.1f%% of %d" "$BRANCH_PCT" "$BRANCHES")
+    fi
+
+    BELOW=$(awk -v lp="$LINE_PCT" -v bp="$BRANCH_PCT" -v bn="$BRANCHES" \
+        -v ml="$MIN_LINES" -v mb="$MIN_BRANCHES" \
+        'BEGIN { print (lp < ml || (bn > 0 && bp < mb)) ? 1 : 0 }')
+    if [ "$BELOW" -eq 1 ]; then
+        COLOR=$RED
+        FAILED=1
+        GCOV_FILE="$REPORT_DIR/$name.gcov"
+        UNCOVERED=$(awk -F: '$1 ~ /#####/ { gsub(/ /, "", $2); printf "%s%s", sep, $2; sep = "," }' "$GCOV_FILE" 2>/dev/null)
+        UNTAKEN=$(awk -F: '
+            /^ *([0-9]+\*?|#####|-):/ { line = $2; gsub(/ /, "", line) }
+            /^branch .*(never executed|taken 0%)/ && !(line in seen) {
+                seen[line] = 1; printf "%s%s", sep, line; sep = ","
+            }' "$GCOV_FILE" 2>/dev/null)
+        DETAILS="$DETAILS$name: uncovered lines [${UNCOVERED:-none}], untaken branches at lines [${UNTAKEN:-none}]\n"
+    else
+        COLOR=$GREEN
+    fi
+    printf "${COLOR}%-24s %16s %16s${NC}\n" "$name" "$(printf "%.1f%% of %d" "$LINE_PCT" "$LINES")" "$BRANCH_COL"
+done
+
+printf "%-24s %16s %16s\n" "----" "-----" "--------"
+printf "%-24s %16s %16s\n" "Total" \
+    "$(awk -v h="$TOTAL_LINES_HIT" -v n="$TOTAL_LINES" 'BEGIN { printf "%.1f%% of %d", n ? 100 * h / n : 100, n }')" \
+    "$(awk -v h="$TOTAL_BRANCHES_HIT" -v n="$TOTAL_BRANCHES" 'BEGIN { printf "%.1f%% of %d", n ? 100 * h / n : 100, n }')"
+echo ""
+
+if [ "$FAILED" -eq 0 ]; then
+    echo -e "${GREEN}✅ All files meet the thresholds (lines >= $MIN_LINES%, branches >= $MIN_BRANCHES%)${NC}"
+    exit 0
+fi
+
+echo -e "${YELLOW}Below threshold (lines >= $MIN_LINES%, branches >= $MIN_BRANCHES%):${NC}"
+echo -e "$DETAILS"
+echo -e "${YELLOW}Annotated sources: $REPORT_DIR/${NC}"
+echo -e "${RED}❌ Coverage below threshold${NC}"
+exit 1
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_split_iter.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft_ext.h"
+
+/*
+** Prepares it to walk the words of s separated by c, like ft_split.
+** Nothing is allocated and s must stay valid while it is used.
+*/
+void	ft_split_iter_init(t_split_iter *it, char const *s, char c)
+{
+	it->next = s;
+	it->c = c;
+}
+
+/*
+** Stores the next word as a view into the original string (*token points
+** inside s, *len is its length; it is not NUL-terminated) and returns 1.
+** Returns 0 once there are no words left.
+*/
+int	ft_split_next(t_split_iter *it, const char **token, size_t *len)
+{
+	const char	*s;
+	size_t		i;
+
+	s = it->next;
+	if (!s)
+		return (0);
+	while (*s && *s == it->c)
+		s++;
+	it->next = s;
+	if (!*s)
+		return (0);
+	i = 0;
+	while (s[i] && s[i] != it->c)
+		i++;
+	*token = s;
+	*len = i;
+	it->next = s + i;
+	return (1);
+}
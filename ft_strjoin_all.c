@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strjoin_all.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 12:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft_ext.h"
+#include <stdlib.h>
+
+static size_t	str_len(char const *s)
+{
+	size_t	len;
+
+	len = 0;
+	while (s[len])
+		len++;
+	return (len);
+}
+
+static char	*copy_str(char *dst, char const *src)
+{
+	while (*src)
+		*dst++ = *src++;
+	return (dst);
+}
+
+static size_t	joined_len(char const **parts, size_t count, char const *sep)
+{
+	size_t	total;
+	size_t	i;
+
+	total = 0;
+	i = 0;
+	while (i < count)
+		total += str_len(parts[i++]);
+	if (count > 1)
+		total += (count - 1) * str_len(sep);
+	return (total);
+}
+
+/*
+** Joins the count strings of parts, with sep (which may be NULL) between
+** each of them, into a new string. The total length is computed first so
+** that every part is copied exactly once, unlike chained ft_strjoin calls
+** which copy the whole result again for every part.
+** Returns NULL if the allocation fails.
+*/
+char	*ft_strjoin_all(char const **parts, size_t count, char const *sep)
+{
+	size_t	i;
+	char	*res;
+	char	*end;
+
+	if (!sep)
+		sep = "";
+	res = malloc(joined_len(parts, count, sep) + 1);
+	if (!res)
+		return (NULL);
+	end = res;
+	i = 0;
+	while (i < count)
+	{
+		if (i > 0)
+			end = copy_str(end, sep);
+		end = copy_str(end, parts[i++]);
+	}
+	*end = '\0';
+	return (res);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strnstr_fast.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:40:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft_ext.h"
+#include "ft_strnstr_fast.h"
+
+/*
+** Two-Way string matching (Crochemore & Perrin, 1991): linear time in
+** len + strlen(needle), constant space, with the semantics of ft_strnstr.
+** The needle is cut at a critical factorization n = u.v; v is matched left
+** to right, then u right to left, and a mismatch shifts by the period.
+** The search loops are in ft_strnstr_fast_search.c.
+*/
+
+/*
+** One step of the maximal suffix scan, with diff the comparison of
+** n[j + k] and n[ms + k] in the order being used.
+*/
+static void	max_suffix_step(t_maxsuffix *s, int diff)
+{
+	if (diff == 0 && s->k != s->period)
+	{
+		s->k++;
+		return ;
+	}
+	if (diff < 0)
+		s->j += s->k;
+	else if (diff > 0)
+		s->ms = s->j++;
+	else
+		s->j += s->period;
+	if (diff != 0)
+		s->period = s->j - s->ms;
+	s->k = 1;
+}
+
+/*
+** Returns the start of the maximal suffix of n (for the alphabet order if
+** sign is 1, its reverse if -1) minus one, and stores its period.
+*/
+static size_t	max_suffix(const unsigned char *n, size_t nlen, size_t *period,
+		int sign)
+{
+	t_maxsuffix	s;
+
+	s.ms = (size_t)-1;
+	s.j = 0;
+	s.k = 1;
+	s.period = 1;
+	while (s.j + s.k < nlen)
+		max_suffix_step(&s, ((int)n[s.j + s.k] - (int)n[s.ms + s.k]) * sign);
+	*period = s.period;
+	return (s.ms);
+}
+
+static void	critical_factorization(t_twoway *tw)
+{
+	size_t	ms;
+	size_t	ms_rev;
+	size_t	period_rev;
+
+	if (tw->nlen < 3)
+	{
+		tw->period = 1;
+		tw->suffix = tw->nlen - 1;
+		return ;
+	}
+	ms = max_suffix(tw->n, tw->nlen, &tw->period, 1);
+	ms_rev = max_suffix(tw->n, tw->nlen, &period_rev, -1);
+	if (ms_rev + 1 < ms + 1)
+		tw->suffix = ms + 1;
+	else
+	{
+		tw->suffix = ms_rev + 1;
+		tw->period = period_rev;
+	}
+}
+
+/*
+** Returns 1 if haystack + j holds at least nlen chars before the limit and
+** before any '\0'. The haystack is scanned lazily, so a match near its
+** start never reads the rest of it.
+*/
+int	ft_twoway_available(t_twoway *tw, size_t j)
+{
+	size_t	stop;
+	size_t	hlen;
+
+	if (tw->hlen >= j + tw->nlen)
+		return (1);
+	stop = j + tw->nlen + 4096;
+	if (stop > tw->limit || stop < j)
+		stop = tw->limit;
+	hlen = tw->hlen;
+	while (hlen < stop && tw->h[hlen])
+		hlen++;
+	tw->hlen = hlen;
+	return (hlen >= j + tw->nlen);
+}
+
+/*
+** Same result as ft_strnstr: the first occurrence of needle that ends
+** within the first len chars of haystack and before its '\0', haystack if
+** needle is empty, NULL otherwise. Never reads past len or the '\0'.
+*/
+char	*ft_strnstr_fast(const char *haystack, const char *needle, size_t len)
+{
+	t_twoway	tw;
+	size_t		i;
+
+	if (!*needle)
+		return ((char *)haystack);
+	tw.nlen = 0;
+	while (needle[tw.nlen])
+		tw.nlen++;
+	if (tw.nlen > len)
+		return (NULL);
+	tw.h = (const unsigned char *)haystack;
+	tw.n = (const unsigned char *)needle;
+	tw.hlen = 0;
+	tw.limit = len;
+	critical_factorization(&tw);
+	i = 0;
+	while (i < tw.suffix && tw.n[i] == tw.n[i + tw.period])
+		i++;
+	if (i == tw.suffix)
+		return (ft_twoway_periodic(&tw));
+	return (ft_twoway_distinct(&tw));
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strnstr_fast.h                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:40:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:40:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_STRNSTR_FAST_H
+# define FT_STRNSTR_FAST_H
+
+# include <stddef.h>
+
+/*
+** Private to ft_strnstr_fast.c and ft_strnstr_fast_search.c: the needle,
+** its critical factorization n = u.v (v starts at suffix) and the part of
+** the haystack already scanned (hlen chars, never past limit).
+*/
+
+typedef struct s_twoway
+{
+	const unsigned char	*h;
+	const unsigned char	*n;
+	size_t				nlen;
+	size_t				hlen;
+	size_t				limit;
+	size_t				suffix;
+	size_t				period;
+}	t_twoway;
+
+/*
+** State of the maximal suffix scan: candidate start ms, position j,
+** offset k and period.
+*/
+
+typedef struct s_maxsuffix
+{
+	size_t	ms;
+	size_t	j;
+	size_t	k;
+	size_t	period;
+}	t_maxsuffix;
+
+int		ft_twoway_available(t_twoway *tw, size_t j);
+char	*ft_twoway_periodic(t_twoway *tw);
+char	*ft_twoway_distinct(t_twoway *tw);
+
+#endif
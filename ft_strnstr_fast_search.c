@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strnstr_fast_search.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:40:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:40:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strnstr_fast.h"
+
+/*
+** Search loops of the Two-Way algorithm for ft_strnstr_fast. j is the
+** haystack position being tried; v is matched first, then u.
+*/
+
+/*
+** Returns the first position from j, within the part of the haystack
+** already scanned, where the first char of v matches (or the first one
+** past that part). Makes the common first-char mismatch cheap.
+*/
+static size_t	skip_to_v(t_twoway *tw, size_t j)
+{
+	size_t			last;
+	unsigned char	c;
+
+	last = tw->hlen - tw->nlen;
+	c = tw->n[tw->suffix];
+	while (j <= last && tw->h[j + tw->suffix] != c)
+		j++;
+	return (j);
+}
+
+/*
+** Matches v at *j from n[max(suffix, memory)] on. Returns 1 if it matched;
+** otherwise moves *j to the next position to try and returns 0.
+*/
+static int	match_v(t_twoway *tw, size_t *j, size_t memory)
+{
+	size_t	i;
+
+	i = tw->suffix;
+	if (memory > i)
+		i = memory;
+	while (i < tw->nlen && tw->n[i] == tw->h[i + *j])
+		i++;
+	if (i == tw->nlen)
+		return (1);
+	if (i == tw->suffix)
+		*j = skip_to_v(tw, *j + 1);
+	else
+		*j += i - tw->suffix + 1;
+	return (0);
+}
+
+/*
+** Returns 1 if u matches at j, right to left, down to n[memory].
+*/
+static int	match_u(t_twoway *tw, size_t j, size_t memory)
+{
+	size_t	i;
+
+	i = tw->suffix;
+	while (i > memory && tw->n[i - 1] == tw->h[i - 1 + j])
+		i--;
+	return (i <= memory);
+}
+
+/*
+** The needle is periodic: after v matched, memory keeps how much of the
+** needle is already known to match at the next shift by the period.
+*/
+char	*ft_twoway_periodic(t_twoway *tw)
+{
+	size_t	j;
+	size_t	memory;
+
+	j = 0;
+	memory = 0;
+	while (ft_twoway_available(tw, j))
+	{
+		if (!match_v(tw, &j, memory))
+			memory = 0;
+		else if (match_u(tw, j, memory))
+			return ((char *)tw->h + j);
+		else
+		{
+			j += tw->period;
+			memory = tw->nlen - tw->period;
+		}
+	}
+	return (NULL);
+}
+
+/*
+** u and v are distinct: any mismatch in u shifts by the longest half + 1.
+*/
+char	*ft_twoway_distinct(t_twoway *tw)
+{
+	size_t	j;
+	size_t	shift;
+
+	shift = tw->suffix;
+	if (tw->nlen - tw->suffix > shift)
+		shift = tw->nlen - tw->suffix;
+	j = 0;
+	while (ft_twoway_available(tw, j))
+	{
+		if (match_v(tw, &j, 0))
+		{
+			if (match_u(tw, j, 0))
+				return ((char *)tw->h + j);
+			j += shift + 1;
+		}
+	}
+	return (NULL);
+}
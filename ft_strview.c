@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strview.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 11:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft_ext.h"
+
+static t_strview	make_view(const char *ptr, size_t len)
+{
+	t_strview	view;
+
+	view.ptr = ptr;
+	view.len = len;
+	return (view);
+}
+
+/*
+** Same bounds as ft_substr, without allocating: the view starts at
+** s + start (or at the end of s if start is past it) and holds at most
+** len chars. Only the first start + len chars of s are read.
+*/
+t_strview	ft_substr_view(char const *s, unsigned int start, size_t len)
+{
+	size_t	end;
+	size_t	i;
+
+	if (!s)
+		return (make_view(NULL, 0));
+	end = start + len;
+	if (end < len)
+		end = (size_t)-1;
+	i = 0;
+	while (i < end && s[i])
+		i++;
+	if (i <= start)
+		return (make_view(s + i, 0));
+	return (make_view(s + start, i - start));
+}
+
+static int	in_set(char c, char const *set)
+{
+	while (*set)
+	{
+		if (*set == c)
+			return (1);
+		set++;
+	}
+	return (0);
+}
+
+/*
+** Same bounds as ft_strtrim, without allocating: the view covers s1
+** without the leading and trailing chars found in set.
+*/
+t_strview	ft_strtrim_view(char const *s1, char const *set)
+{
+	size_t	start;
+	size_t	end;
+
+	if (!s1 || !set)
+		return (make_view(s1, 0));
+	start = 0;
+	while (s1[start] && in_set(s1[start], set))
+		start++;
+	end = start;
+	while (s1[end])
+		end++;
+	while (end > start && in_set(s1[end - 1], set))
+		end--;
+	return (make_view(s1 + start, end - start));
+}
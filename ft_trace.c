@@ -0,0 +1,281 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_trace.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../libft.h"
+#include "ft_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Instrumented libft. Linked with -Wl,--wrap=ft_<name> for every libft
+// function (see TRACE_LDFLAGS in Makefile.test), every call to ft_<name>
+// goes to __wrap_ft_<name> below, which times __real_ft_<name> and records
+// the call count, a histogram of its size argument and a histogram of its
+// latency in a shared-memory region. At exit the functions that were called
+// are dumped to $LIBFT_TRACE (default libft_trace.<pid>.bin); read the dump
+// with trace_report.
+
+// Size helpers, evaluated before the call and outside the timed region.
+// They use libc so that they are not traced themselves.
+static size_t slen(const char *s)
+{
+    return s ? strlen(s) : 0;
+}
+
+static size_t mul_sat(size_t a, size_t b)
+{
+    return b && a > SIZE_MAX / b ? SIZE_MAX : a * b;
+}
+
+#ifdef BONUS_TESTS
+static size_t lst_len(t_list *lst)
+{
+    size_t n = 0;
+
+    while (lst)
+    {
+        n++;
+        lst = lst->next;
+    }
+    return n;
+}
+
+# define TRACE_BONUS_FUNCTIONS(FN, VOID_FN) \
+    FN(t_list *, ft_lstnew, (void *content), (content), "-", 0) \
+    VOID_FN(ft_lstadd_front, (t_list **lst, t_list *new), (lst, new), "-", 0) \
+    FN(int, ft_lstsize, (t_list *lst), (lst), "list length", lst_len(lst)) \
+    FN(t_list *, ft_lstlast, (t_list *lst), (lst), "list length", lst_len(lst)) \
+    VOID_FN(ft_lstadd_back, (t_list **lst, t_list *new), (lst, new), "list length", \
+            lst ? lst_len(*lst) : 0) \
+    VOID_FN(ft_lstdelone, (t_list *lst, void (*del)(void *)), (lst, del), "-", 0) \
+    VOID_FN(ft_lstclear, (t_list **lst, void (*del)(void *)), (lst, del), "list length", \
+            lst ? lst_len(*lst) : 0) \
+    VOID_FN(ft_lstiter, (t_list *lst, void (*f)(void *)), (lst, f), "list length", lst_len(lst)) \
+    FN(t_list *, ft_lstmap, (t_list *lst, void *(*f)(void *), void (*del)(void *)), (lst, f, del), \
+       "list length", lst_len(lst))
+#else
+# define TRACE_BONUS_FUNCTIONS(FN, VOID_FN)
+#endif
+
+// Every traced function: return type (FN only), name, parameters, arguments,
+// what the recorded size is, and how to compute it from the arguments
+#define TRACE_FUNCTIONS(FN, VOID_FN) \
+    FN(int, ft_atoi, (const char *str), (str), "strlen(str)", slen(str)) \
+    VOID_FN(ft_bzero, (void *s, size_t n), (s, n), "n", n) \
+    FN(void *, ft_calloc, (size_t count, size_t size), (count, size), "count * size", \
+       mul_sat(count, size)) \
+    FN(int, ft_isalnum, (int c), (c), "-", 0) \
+    FN(int, ft_isalpha, (int c), (c), "-", 0) \
+    FN(int, ft_isascii, (int c), (c), "-", 0) \
+    FN(int, ft_isdigit, (int c), (c), "-", 0) \
+    FN(int, ft_isprint, (int c), (c), "-", 0) \
+    FN(char *, ft_itoa, (int n), (n), "-", 0) \
+    FN(void *, ft_memchr, (const void *s, int c, size_t n), (s, c, n), "n", n) \
+    FN(int, ft_memcmp, (const void *s1, const void *s2, size_t n), (s1, s2, n), "n", n) \
+    FN(void *, ft_memcpy, (void *dst, const void *src, size_t n), (dst, src, n), "n", n) \
+    FN(void *, ft_memmove, (void *dst, const void *src, size_t len), (dst, src, len), "len", len) \
+    FN(void *, ft_memset, (void *b, int c, size_t len), (b, c, len), "len", len) \
+    VOID_FN(ft_putchar_fd, (char c, int fd), (c, fd), "-", 0) \
+    VOID_FN(ft_putendl_fd, (char *s, int fd), (s, fd), "strlen(s)", slen(s)) \
+    VOID_FN(ft_putnbr_fd, (int n, int fd), (n, fd), "-", 0) \
+    VOID_FN(ft_putstr_fd, (char *s, int fd), (s, fd), "strlen(s)", slen(s)) \
+    FN(char **, ft_split, (char const *s, char c), (s, c), "strlen(s)", slen(s)) \
+    FN(char *, ft_strchr, (const char *s, int c), (s, c), "strlen(s)", slen(s)) \
+    FN(char *, ft_strdup, (const char *s1), (s1), "strlen(s1)", slen(s1)) \
+    VOID_FN(ft_striteri, (char *s, void (*f)(unsigned int, char *)), (s, f), "strlen(s)", slen(s)) \
+    FN(char *, ft_strjoin, (char const *s1, char const *s2), (s1, s2), "strlen(s1) + strlen(s2)", \
+       slen(s1) + slen(s2)) \
+    FN(size_t, ft_strlcat, (char *dst, const char *src, size_t dstsize), (dst, src, dstsize), \
+       "dstsize", dstsize) \
+    FN(size_t, ft_strlcpy, (char *dst, const char *src, size_t dstsize), (dst, src, dstsize), \
+       "dstsize", dstsize) \
+    FN(size_t, ft_strlen, (const char *s), (s), "strlen(s)", slen(s)) \
+    FN(char *, ft_strmapi, (char const *s, char (*f)(unsigned int, char)), (s, f), "strlen(s)", slen(s)) \
+    FN(int, ft_strncmp, (const char *s1, const char *s2, size_t n), (s1, s2, n), "n", n) \
+    FN(char *, ft_strnstr, (const char *haystack, const char *needle, size_t len), \
+       (haystack, needle, len), "len", len) \
+    FN(char *, ft_strrchr, (const char *s, int c), (s, c), "strlen(s)", slen(s)) \
+    FN(char *, ft_strtrim, (char const *s1, char const *set), (s1, set), "strlen(s1)", slen(s1)) \
+    FN(char *, ft_substr, (char const *s, unsigned int start, size_t len), (s, start, len), "len", len) \
+    FN(int, ft_tolower, (int c), (c), "-", 0) \
+    FN(int, ft_toupper, (int c), (c), "-", 0) \
+    TRACE_BONUS_FUNCTIONS(FN, VOID_FN)
+
+#define TRACE_ID(ret, name, ...) TRACE_##name,
+#define TRACE_VOID_ID(name, ...) TRACE_##name,
+
+enum e_trace_id
+{
+    TRACE_FUNCTIONS(TRACE_ID, TRACE_VOID_ID)
+    TRACE_COUNT
+};
+
+// Header and one record per function, in the order of TRACE_FUNCTIONS
+typedef struct s_trace_region
+{
+    t_trace_header header;
+    t_trace_func funcs[TRACE_COUNT];
+} t_trace_region;
+
+#define TRACE_INFO(ret, name, params, args, size_arg, size) {#name, size_arg},
+#define TRACE_VOID_INFO(name, params, args, size_arg, size) {#name, size_arg},
+
+static const struct
+{
+    const char *name;
+    const char *size_arg;
+} trace_info[TRACE_COUNT] = {TRACE_FUNCTIONS(TRACE_INFO, TRACE_VOID_INFO)};
+
+// Used until the shared-memory region is mapped, or if it cannot be
+static t_trace_region trace_fallback;
+static t_trace_region *trace = &trace_fallback;
+static char trace_shm_name[64];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int bucket(uint64_t value)
+{
+    int b = value ? 64 - __builtin_clzll(value) : 0;
+
+    return b < TRACE_BUCKETS ? b : TRACE_BUCKETS - 1;
+}
+
+// Time spent in traced calls made by the current call (e.g. ft_strlen in
+// ft_strdup), so that only self time is recorded and the totals add up
+static __thread uint64_t trace_nested_ns;
+
+// Starts a traced call; returns the caller's nested time, restored by
+// trace_record
+static uint64_t trace_enter(void)
+{
+    uint64_t outer = trace_nested_ns;
+
+    trace_nested_ns = 0;
+    return outer;
+}
+
+// Counters are updated atomically so multithreaded workloads can be traced
+static void trace_record(int id, size_t size, uint64_t start, uint64_t outer)
+{
+    uint64_t elapsed = now_ns() - start;
+    uint64_t ns = elapsed - trace_nested_ns;
+    t_trace_func *f = &trace->funcs[id];
+
+    trace_nested_ns = outer + elapsed;
+
+    __atomic_fetch_add(&f->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&f->total_ns, ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&f->size_hist[bucket(size)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&f->ns_hist[bucket(ns)], 1, __ATOMIC_RELAXED);
+}
+
+#define TRACE_WRAP(ret, name, params, args, size_arg, size) \
+    ret __real_##name params; \
+    ret __wrap_##name params \
+    { \
+        size_t trace_size = (size); \
+        uint64_t trace_outer = trace_enter(); \
+        uint64_t trace_start = now_ns(); \
+        ret trace_ret = __real_##name args; \
+        trace_record(TRACE_##name, trace_size, trace_start, trace_outer); \
+        return trace_ret; \
+    }
+
+#define TRACE_VOID_WRAP(name, params, args, size_arg, size) \
+    void __real_##name params; \
+    void __wrap_##name params \
+    { \
+        size_t trace_size = (size); \
+        uint64_t trace_outer = trace_enter(); \
+        uint64_t trace_start = now_ns(); \
+        __real_##name args; \
+        trace_record(TRACE_##name, trace_size, trace_start, trace_outer); \
+    }
+
+TRACE_FUNCTIONS(TRACE_WRAP, TRACE_VOID_WRAP)
+
+// Writes the header and the records of every function that was called
+static void trace_dump(void)
+{
+    t_trace_header header = trace->header;
+    const char *path = getenv("LIBFT_TRACE");
+    char default_path[64];
+    FILE *out;
+
+    // Forked children share the region; only the process that created it dumps
+    if (header.pid != (uint32_t)getpid())
+        return;
+    if (!path || !*path)
+    {
+        snprintf(default_path, sizeof(default_path), "libft_trace.%d.bin", (int)getpid());
+        path = default_path;
+    }
+    header.count = 0;
+    for (int i = 0; i < TRACE_COUNT; i++)
+        header.count += trace->funcs[i].calls > 0;
+    out = fopen(path, "wb");
+    if (out)
+    {
+        fwrite(&header, sizeof(header), 1, out);
+        for (int i = 0; i < TRACE_COUNT; i++)
+            if (trace->funcs[i].calls > 0)
+                fwrite(&trace->funcs[i], sizeof(t_trace_func), 1, out);
+        fclose(out);
+    }
+    else
+        fprintf(stderr, "libft trace: cannot write %s\n", path);
+    if (trace != &trace_fallback)
+        shm_unlink(trace_shm_name);
+}
+
+// Maps /dev/shm/libft_trace.<pid> before main() so the statistics can be
+// read while the workload runs (trace_report /dev/shm/libft_trace.<pid>)
+__attribute__((constructor)) static void trace_init(void)
+{
+    t_trace_region *region = &trace_fallback;
+    int fd;
+
+    snprintf(trace_shm_name, sizeof(trace_shm_name), "/libft_trace.%d", (int)getpid());
+    fd = shm_open(trace_shm_name, O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (fd >= 0 && ftruncate(fd, sizeof(t_trace_region)) == 0)
+    {
+        region = mmap(NULL, sizeof(t_trace_region), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (region == MAP_FAILED)
+            region = &trace_fallback;
+    }
+    if (fd >= 0)
+        close(fd);
+    if (region == &trace_fallback)
+        shm_unlink(trace_shm_name);
+    for (int i = 0; i < TRACE_COUNT; i++)
+    {
+        strncpy(region->funcs[i].name, trace_info[i].name, TRACE_NAME_LEN - 1);
+        strncpy(region->funcs[i].size_arg, trace_info[i].size_arg, TRACE_ARG_LEN - 1);
+    }
+    region->header.version = TRACE_VERSION;
+    region->header.count = TRACE_COUNT;
+    region->header.buckets = TRACE_BUCKETS;
+    region->header.pid = getpid();
+    memcpy(region->header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    trace = region;
+    atexit(trace_dump);
+}
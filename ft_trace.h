@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_trace.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 15:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_TRACE_H
+# define FT_TRACE_H
+
+# include <stdint.h>
+
+/*
+** Layout of the call statistics recorded by the instrumented libft build
+** (ft_trace.c) and read by trace_report.c. The same layout is used for the
+** live shared-memory region (/dev/shm/libft_trace.<pid>, one record per
+** libft function) and for the file dumped at exit (one record per function
+** that was called). All fields are in host byte order.
+**
+** total_ns and ns_hist are self time: the time of traced libft calls made
+** by the function (e.g. ft_strlen in ft_strdup) is counted only for them.
+**
+** Histogram bucket 0 counts zeros, bucket i counts values in
+** [2^(i-1), 2^i), and the last bucket also counts everything above.
+*/
+
+# define TRACE_MAGIC "FTTRACE"
+# define TRACE_VERSION 2
+# define TRACE_BUCKETS 32
+# define TRACE_NAME_LEN 16
+# define TRACE_ARG_LEN 24
+
+typedef struct s_trace_header
+{
+	char		magic[8];
+	uint32_t	version;
+	uint32_t	count;
+	uint32_t	buckets;
+	uint32_t	pid;
+}	t_trace_header;
+
+/*
+** size_arg names what size_hist measures, e.g. "n" or "strlen(s)";
+** it is "-" for functions without a size.
+*/
+typedef struct s_trace_func
+{
+	char		name[TRACE_NAME_LEN];
+	char		size_arg[TRACE_ARG_LEN];
+	uint64_t	calls;
+	uint64_t	total_ns;
+	uint64_t	size_hist[TRACE_BUCKETS];
+	uint64_t	ns_hist[TRACE_BUCKETS];
+}	t_trace_func;
+
+#endif
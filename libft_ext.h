@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libft_ext.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:40:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBFT_EXT_H
+# define LIBFT_EXT_H
+
+# include <stddef.h>
+
+/*
+** Companion APIs for libft that work on (pointer, length) views of the
+** input instead of allocating new strings.
+*/
+
+typedef struct s_strview
+{
+	const char	*ptr;
+	size_t		len;
+}	t_strview;
+
+typedef struct s_split_iter
+{
+	const char	*next;
+	char		c;
+}	t_split_iter;
+
+void		ft_split_iter_init(t_split_iter *it, char const *s, char c);
+int			ft_split_next(t_split_iter *it, const char **token, size_t *len);
+t_strview	ft_substr_view(char const *s, unsigned int start, size_t len);
+t_strview	ft_strtrim_view(char const *s1, char const *set);
+char		*ft_strjoin_all(char const **parts, size_t count, char const *sep);
+char		*ft_strnstr_fast(const char *haystack, const char *needle,
+				size_t len);
+
+#endif
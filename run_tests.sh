@@ -19,6 +19,9 @@ MANDATORY_ONLY=false
 VERBOSE=false
 CHECK_NORM=false
 NORM_ONLY=false
+SANITIZERS=""
+PROFILE="full"
+DURATION=""
 
 # Parse command line arguments
 while [[ $# -gt 0 ]]; do
@@ -27,6 +30,22 @@ while [[ $# -gt 0 ]]; do
             RUN_VALGRIND=true
             shift
             ;;
+        --asan|--ubsan|--tsan)
+            SANITIZERS="$SANITIZERS ${1#--}"
+            shift
+            ;;
+        -s|--sanitize)
+            SANITIZERS="asan ubsan"
+            shift
+            ;;
+        --profile=full|--profile=smoke|--profile=soak)
+            PROFILE="${1#--profile=}"
+            shift
+            ;;
+        --duration=*)
+            DURATION="${1#--duration=}"
+            shift
+            ;;
         -m|--mandatory)
             MANDATORY_ONLY=true
             shift
@@ -52,7 +71,15 @@ while [[ $# -gt 0 ]]; do
             echo "Usage: $0 [options]"
             echo "Options:"
             echo "  -v, --valgrind    Run tests with valgrind"
+            echo "  --asan            Run tests with AddressSanitizer (+ leak check)"
+            echo "  --ubsan           Run tests with UndefinedBehaviorSanitizer"
+            echo "  --tsan            Run tests with ThreadSanitizer"
+            echo "  -s, --sanitize    Run tests under asan and ubsan"
             echo "  -m, --mandatory   Test only mandatory functions"
+            echo "  --profile=smoke   Run all tests on reduced inputs (< 200 ms, for pre-commit hooks)"
+            echo "  --profile=soak    Run randomized tests for a fixed time, reporting throughput and RSS"
+            echo "  --profile=full    Run all tests once (default)"
+            echo "  --duration=SECS   Soak duration in seconds (default 600)"
             echo "  -n, --norm        Check norminette compliance before running tests"
             echo "  --norm-only       Only check norminette compliance (don't run tests)"
             echo "  -f, --full        Run norminette check + all tests (equivalent to --norm)"
@@ -64,6 +91,8 @@ while [[ $# -gt 0 ]]; do
             echo "  $0 --norm         # Check norminette + run tests"
             echo "  $0 --norm-only    # Only check norminette"
             echo "  $0 -m --norm      # Check norminette + run mandatory tests only"
+            echo "  $0 --asan --ubsan # Run tests under ASan and UBSan"
+            echo "  $0 --profile=soak --duration=60 # Soak for one minute"
             exit 0
             ;;
         *)
@@ -171,9 +200,51 @@ if [ "$CHECK_NORM" = true ]; then
     echo ""
 fi
 
-# Clean previous builds
-echo -e "${YELLOW}Cleaning previous builds...${NC}"
-make -f Makefile.test fclean > /dev/null 2>&1
+# Arguments for the test executable
+TEST_ARGS=("--profile=$PROFILE")
+if [ -n "$DURATION" ]; then
+    TEST_ARGS+=("--duration=$DURATION")
+fi
+
+# Clean previous builds (smoke runs build incrementally to stay fast)
+if [ "$PROFILE" != smoke ]; then
+    echo -e "${YELLOW}Cleaning previous builds...${NC}"
+    make -f Makefile.test fclean > /dev/null 2>&1
+fi
+
+# Run the sanitizer builds instead of the plain test suite if requested
+if [ -n "$SANITIZERS" ]; then
+    SAN_MAKE_ARGS=("SANITIZERS=${SANITIZERS# }" "TEST_ARGS=${TEST_ARGS[*]}")
+    if [ "$MANDATORY_ONLY" = true ]; then
+        SAN_MAKE_ARGS+=("BONUS_FLAGS=" "BONUS_OBJS=")
+    fi
+    if [ "$VERBOSE" = false ]; then
+        SAN_MAKE_ARGS+=("-s")
+    fi
+
+    echo -e "${YELLOW}Building and running tests with sanitizers:${SANITIZERS}...${NC}"
+    echo ""
+    set +e
+    make -f Makefile.test --no-print-directory sanitize "${SAN_MAKE_ARGS[@]}"
+    TEST_EXIT_CODE=$?
+    set -e
+
+    echo ""
+    if [ $TEST_EXIT_CODE -eq 0 ]; then
+        echo -e "${GREEN}=======================================${NC}"
+        echo -e "${GREEN}    🎉 ALL TESTS PASSED! 🎉           ${NC}"
+        echo -e "${GREEN}    ✅ NO SANITIZER FINDINGS ✅       ${NC}"
+        echo -e "${GREEN}=======================================${NC}"
+    else
+        echo -e "${RED}=======================================${NC}"
+        echo -e "${RED}    ❌ TESTS OR SANITIZERS FAILED ❌   ${NC}"
+        echo -e "${RED}=======================================${NC}"
+    fi
+
+    echo -e "${YELLOW}Cleaning up...${NC}"
+    make -f Makefile.test clean > /dev/null 2>&1
+    exit $TEST_EXIT_CODE
+fi
 
 # Build the appropriate test suite
 if [ "$MANDATORY_ONLY" = true ]; then
@@ -212,16 +283,16 @@ if [ "$RUN_VALGRIND" = true ]; then
     if command -v valgrind >/dev/null 2>&1; then
         echo -e "${YELLOW}Running tests with valgrind...${NC}"
         echo ""
-        valgrind --leak-check=full --show-leak-kinds=all --track-origins=yes $TEST_EXECUTABLE
+        valgrind --leak-check=full --show-leak-kinds=all --track-origins=yes $TEST_EXECUTABLE "${TEST_ARGS[@]}"
     else
         echo -e "${YELLOW}Valgrind not found, running tests without memory checking...${NC}"
         echo ""
-        $TEST_EXECUTABLE
+        $TEST_EXECUTABLE "${TEST_ARGS[@]}"
     fi
 else
     echo -e "${YELLOW}Running tests...${NC}"
     echo ""
-    $TEST_EXECUTABLE
+    $TEST_EXECUTABLE "${TEST_ARGS[@]}"
 fi
 
 # Store the exit code
@@ -243,8 +314,10 @@ else
     echo -e "${RED}=======================================${NC}"
 fi
 
-# Clean up
-echo -e "${YELLOW}Cleaning up...${NC}"
-make -f Makefile.test clean > /dev/null 2>&1
+# Clean up (smoke runs keep their objects for the next incremental build)
+if [ "$PROFILE" != smoke ]; then
+    echo -e "${YELLOW}Cleaning up...${NC}"
+    make -f Makefile.test clean > /dev/null 2>&1
+fi
 
 exit $TEST_EXIT_CODE
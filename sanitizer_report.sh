@@ -0,0 +1,100 @@
+#!/bin/bash
+
+# Sanitizer report for libft
+# Usage: ./sanitizer_report.sh [log_directory]
+#
+# Reads the ASan/UBSan/TSan logs written by `make -f Makefile.test sanitize`
+# (one file per sanitizer run, named <sanitizer>.<pid>) and prints a single
+# summary with one row per libft function. A finding is attributed to the
+# first ft_* frame of its stack trace; findings with no ft_* frame are
+# reported under "(test code)".
+# Exits with 1 if any finding was reported, 0 otherwise.
+
+LOG_DIR="${1:-san_logs}"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+BLUE='\033[0;34m'
+NC='\033[0m' # No Color
+
+echo -e "${BLUE}=======================================${NC}"
+echo -e "${BLUE}        SANITIZER SUMMARY             ${NC}"
+echo -e "${BLUE}=======================================${NC}"
+
+LOG_FILES=$(ls "$LOG_DIR"/asan.* "$LOG_DIR"/ubsan.* "$LOG_DIR"/tsan.* 2>/dev/null | grep -v '\.out$')
+
+if [ -z "$LOG_FILES" ]; then
+    echo -e "${GREEN}✅ No sanitizer findings${NC}"
+    exit 0
+fi
+
+# Collect one "function<TAB>sanitizer<TAB>kind" line per finding
+FINDINGS=$(awk '
+    function flush() {
+        if (kind != "")
+            printf "%s\t%s\t%s\n", (fn == "" ? "(test code)" : fn), san, kind
+        kind = ""
+        fn = ""
+    }
+    FNR == 1 {
+        flush()
+        san = FILENAME
+        sub(/.*\//, "", san)
+        sub(/\..*/, "", san)
+    }
+    /ERROR: LeakSanitizer:/ { flush(); next }
+    /(Direct|Indirect) leak of/ { flush(); kind = "memory-leak"; next }
+    /(ERROR|WARNING): (Address|Thread)Sanitizer: / {
+        flush()
+        match($0, /Sanitizer: [A-Za-z-]+( [a-z-]+)?/)
+        kind = substr($0, RSTART + 11, RLENGTH - 11)
+        sub(/ on$/, "", kind)
+        next
+    }
+    /runtime error: / {
+        flush()
+        kind = $0
+        sub(/.*runtime error: /, "", kind)
+        sub(/:.*/, "", kind)
+        if (match($0, /ft_[a-z_]+\.c:/))
+            fn = substr($0, RSTART, RLENGTH - 3)
+        next
+    }
+    /^ *#[0-9]+ / {
+        if (kind != "" && fn == "" && match($0, / in ft_[a-z_]+/))
+            fn = substr($0, RSTART + 4, RLENGTH - 4)
+        next
+    }
+    END { flush() }
+' $LOG_FILES)
+
+if [ -z "$FINDINGS" ]; then
+    echo -e "${GREEN}✅ No sanitizer findings${NC}"
+    exit 0
+fi
+
+printf "%-18s %6s %6s %6s  %s\n" "Function" "asan" "ubsan" "tsan" "Findings"
+printf "%-18s %6s %6s %6s  %s\n" "--------" "----" "-----" "----" "--------"
+echo "$FINDINGS" | sort | awk -F'\t' '
+    {
+        if (!($1 in seen)) { seen[$1] = 1; order[++n] = $1 }
+        count[$1, $2]++
+        total++
+        if (index(kinds[$1], $3) == 0)
+            kinds[$1] = kinds[$1] (kinds[$1] == "" ? "" : ", ") $3
+    }
+    END {
+        for (i = 1; i <= n; i++) {
+            f = order[i]
+            printf "%-18s %6d %6d %6d  %s\n", f, count[f, "asan"], \
+                count[f, "ubsan"], count[f, "tsan"], kinds[f]
+        }
+        printf "\nTotal findings: %d\n", total
+    }
+'
+echo ""
+echo -e "${YELLOW}Full reports: $LOG_DIR/${NC}"
+echo -e "${RED}❌ Sanitizers reported errors${NC}"
+exit 1
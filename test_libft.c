@@ -11,15 +11,41 @@
 /* ************************************************************************** */
 
 #include "../libft.h"
+#include "libft_ext.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
 #include <fcntl.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
 
 // Test counter and result tracking
 static int test_count = 0;
 static int test_passed = 0;
+static const char *first_failure = NULL;
+
+// Test profile, selected with --profile= (see main)
+typedef enum e_profile
+{
+    PROFILE_FULL,
+    PROFILE_SMOKE,
+    PROFILE_SOAK
+} t_profile;
+
+static t_profile profile = PROFILE_FULL;
+
+// Run time the smoke profile is expected to stay under (pre-commit hooks)
+#define SMOKE_BUDGET_MS 200
+
+// Seed for the fuzzed tests; the soak profile changes it every round
+static unsigned int test_seed = 42;
+
+// Bytes of fuzzed input generated so far; the soak profile divides it by
+// time, since rounds vary in size with the seed
+static unsigned long fuzz_bytes = 0;
 
 // Color codes for output
 #define GREEN "\033[32m"
@@ -41,6 +67,8 @@ static int test_passed = 0;
         else                                            \
         {                                               \
             printf(RED "✗ " RESET "%s\n", test_name);   \
+            if (!first_failure)                         \
+                first_failure = test_name;              \
         }                                               \
     } while (0)
 
@@ -74,6 +102,111 @@ void free_array(char **arr)
     free(arr);
 }
 
+// Helper function to fill a buffer with random chars from an alphabet
+void random_string(char *buf, size_t len, const char *alphabet)
+{
+    size_t n = strlen(alphabet);
+
+    fuzz_bytes += len;
+    for (size_t i = 0; i < len; i++)
+        buf[i] = alphabet[rand() % n];
+    buf[len] = '\0';
+}
+
+// Helper function to check that ft_split_next yields exactly ft_split's words
+int split_iter_matches_split(const char *s, char c)
+{
+    char **words = ft_split(s, c);
+    t_split_iter it;
+    const char *token;
+    size_t len;
+    int i = 0;
+
+    if (!words)
+        return 0;
+    ft_split_iter_init(&it, s, c);
+    while (ft_split_next(&it, &token, &len))
+    {
+        if (!words[i] || strlen(words[i]) != len ||
+            strncmp(words[i], token, len) != 0 ||
+            token < s || token + len > s + strlen(s))
+        {
+            free_array(words);
+            return 0;
+        }
+        i++;
+    }
+    int ok = words[i] == NULL;
+    free_array(words);
+    return ok;
+}
+
+// Helper function to check ft_split word by word against a strspn/strcspn walk
+int split_matches_reference(const char *s, char c)
+{
+    char sep[2] = {c, '\0'};
+    char **words = ft_split(s, c);
+    int ok = words != NULL;
+    int i = 0;
+
+    while (ok && *s)
+    {
+        s += strspn(s, sep);
+        if (!*s)
+            break;
+        size_t len = strcspn(s, sep);
+        ok = words[i] && strlen(words[i]) == len && strncmp(words[i], s, len) == 0;
+        i++;
+        s += len;
+    }
+    ok = ok && words[i] == NULL;
+    free_array(words);
+    return ok;
+}
+
+// Helper function for the ft_memmove matrix: got and want are copies of orig.
+// Moves len bytes from src to src + dist with ft_memmove in got and with libc
+// memmove in want, then checks the return value and every byte from
+// MOVE_GUARD bytes before the move to MOVE_GUARD bytes after it. The touched
+// bytes are restored from orig afterwards.
+#define MOVE_GUARD 16
+
+int memmove_matches_libc(unsigned char *got, unsigned char *want,
+                         const unsigned char *orig, size_t src, long dist, size_t len)
+{
+    size_t dst = src + dist;
+    size_t lo = (dist < 0 ? dst : src) - MOVE_GUARD;
+    size_t hi = (dist < 0 ? src : dst) + len + MOVE_GUARD;
+
+    int ok = ft_memmove(got + dst, got + src, len) == got + dst;
+    memmove(want + dst, want + src, len);
+    ok &= memcmp(got + lo, want + lo, hi - lo) == 0;
+    memcpy(got + lo, orig + lo, hi - lo);
+    memcpy(want + lo, orig + lo, hi - lo);
+    return ok;
+}
+
+// Reference strnstr: the naive O(len * strlen(needle)) search
+char *ref_strnstr(const char *haystack, const char *needle, size_t len)
+{
+    size_t nlen = strlen(needle);
+
+    if (nlen == 0)
+        return (char *)haystack;
+    for (size_t i = 0; i + nlen <= len && haystack[i]; i++)
+    {
+        if (strncmp(haystack + i, needle, nlen) == 0)
+            return (char *)haystack + i;
+    }
+    return NULL;
+}
+
+// Helper function to compare a string view with a NUL-terminated string
+int view_equals(t_strview view, const char *str)
+{
+    return str && view.len == strlen(str) && strncmp(view.ptr, str, view.len) == 0;
+}
+
 // Helper function for list deletion
 void del_content(void *content)
 {
@@ -294,6 +427,61 @@ void test_ft_strnstr(void)
     TEST_ASSERT(ft_strnstr(haystack, "xyz", 13) == NULL, "ft_strnstr needle not found");
 }
 
+void test_ft_strnstr_fast(void)
+{
+    printf(BLUE "\n=== Testing ft_strnstr_fast ===\n" RESET);
+
+    char *haystack = "Hello, World!";
+    TEST_ASSERT(ft_strnstr_fast(haystack, "World", 13) == haystack + 7, "ft_strnstr_fast find 'World'");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "Hello", 13) == haystack, "ft_strnstr_fast find at beginning");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "!", 13) == haystack + 12, "ft_strnstr_fast find at end");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "World", 10) == NULL, "ft_strnstr_fast with insufficient length");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "", 13) == haystack, "ft_strnstr_fast empty needle");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "xyz", 13) == NULL, "ft_strnstr_fast needle not found");
+    TEST_ASSERT(ft_strnstr_fast(haystack, "World", (size_t)-1) == haystack + 7,
+                "ft_strnstr_fast with SIZE_MAX length");
+
+    char worst[1002];
+    memset(worst, 'a', 1000);
+    strcpy(worst + 1000, "b");
+    TEST_ASSERT(ft_strnstr_fast(worst, "aaaaaaab", 1001) == worst + 993, "ft_strnstr_fast \"aaa...ab\" match");
+    TEST_ASSERT(ft_strnstr_fast(worst, "aaaaaaab", 1000) == NULL, "ft_strnstr_fast \"aaa...ab\" beyond length");
+    TEST_ASSERT(ft_strnstr_fast(worst, "aaaaaaac", 1001) == NULL, "ft_strnstr_fast \"aaa...ac\" not found");
+
+    // Haystack without a terminating '\0': must not read past len
+    char *unterminated = malloc(8);
+    if (unterminated)
+    {
+        memcpy(unterminated, "abcdefgh", 8);
+        TEST_ASSERT(ft_strnstr_fast(unterminated, "gh", 8) == unterminated + 6,
+                    "ft_strnstr_fast match at len on unterminated haystack");
+        TEST_ASSERT(ft_strnstr_fast(unterminated, "hx", 8) == NULL,
+                    "ft_strnstr_fast no match on unterminated haystack");
+        free(unterminated);
+    }
+
+    char buf[65];
+    char needle[9];
+    int ok_fast = 1;
+    int ok_ft = 1;
+    srand(test_seed);
+    int fuzz_count = profile == PROFILE_SMOKE ? 1000 : 10000;
+    for (int i = 0; i < fuzz_count && (ok_fast || ok_ft); i++)
+    {
+        const char *alphabet = i % 2 ? "ab" : "abc";
+        random_string(buf, rand() % 65, alphabet);
+        random_string(needle, rand() % 9, alphabet);
+        size_t len = i % 10 == 0 ? (size_t)-1 : (size_t)(rand() % 70);
+        char *expected = ref_strnstr(buf, needle, len);
+        ok_fast &= ft_strnstr_fast(buf, needle, len) == expected;
+        ok_ft &= ft_strnstr(buf, needle, len) == expected;
+    }
+    TEST_ASSERT(ok_fast, profile == PROFILE_SMOKE ? "ft_strnstr_fast matches naive search on 1000 fuzzed inputs"
+                                                  : "ft_strnstr_fast matches naive search on 10000 fuzzed inputs");
+    TEST_ASSERT(ok_ft, profile == PROFILE_SMOKE ? "ft_strnstr matches naive search on 1000 fuzzed inputs"
+                                                : "ft_strnstr matches naive search on 10000 fuzzed inputs");
+}
+
 void test_ft_substr(void)
 {
     printf(BLUE "\n=== Testing ft_substr ===\n" RESET);
@@ -317,6 +505,40 @@ void test_ft_substr(void)
     free(result);
 }
 
+void test_ft_substr_view(void)
+{
+    printf(BLUE "\n=== Testing ft_substr_view ===\n" RESET);
+
+    const char *s = "Hello, World!";
+    t_strview view;
+
+    view = ft_substr_view(s, 0, 5);
+    TEST_ASSERT(view.ptr == s && view.len == 5, "ft_substr_view from beginning");
+
+    view = ft_substr_view(s, 7, 5);
+    TEST_ASSERT(view.ptr == s + 7 && view.len == 5, "ft_substr_view from middle");
+
+    view = ft_substr_view("Hello", 10, 5);
+    TEST_ASSERT(view.len == 0, "ft_substr_view start beyond string");
+
+    view = ft_substr_view("Hello", 2, 10);
+    TEST_ASSERT(view_equals(view, "llo"), "ft_substr_view length beyond string");
+
+    char buf[33];
+    int ok = 1;
+    srand(test_seed);
+    for (int i = 0; i < 1000 && ok; i++)
+    {
+        random_string(buf, rand() % 33, "abc");
+        unsigned int start = rand() % 40;
+        size_t len = rand() % 40;
+        char *expected = ft_substr(buf, start, len);
+        ok = view_equals(ft_substr_view(buf, start, len), expected);
+        free(expected);
+    }
+    TEST_ASSERT(ok, "ft_substr_view matches ft_substr on 1000 fuzzed inputs");
+}
+
 void test_ft_strjoin(void)
 {
     printf(BLUE "\n=== Testing ft_strjoin ===\n" RESET);
@@ -336,6 +558,58 @@ void test_ft_strjoin(void)
     free(result);
 }
 
+void test_ft_strjoin_all(void)
+{
+    printf(BLUE "\n=== Testing ft_strjoin_all ===\n" RESET);
+
+    const char *parts[] = {"Hello", "World", "42"};
+    const char *empty_parts[] = {"", "Hello", ""};
+    char *result;
+
+    result = ft_strjoin_all(parts, 3, NULL);
+    TEST_ASSERT(result && strcmp(result, "HelloWorld42") == 0, "ft_strjoin_all without separator");
+    free(result);
+
+    result = ft_strjoin_all(parts, 3, ", ");
+    TEST_ASSERT(result && strcmp(result, "Hello, World, 42") == 0, "ft_strjoin_all with separator");
+    free(result);
+
+    result = ft_strjoin_all(parts, 1, ", ");
+    TEST_ASSERT(result && strcmp(result, "Hello") == 0, "ft_strjoin_all single part");
+    free(result);
+
+    result = ft_strjoin_all(parts, 0, ", ");
+    TEST_ASSERT(result && strcmp(result, "") == 0, "ft_strjoin_all no parts");
+    free(result);
+
+    result = ft_strjoin_all(empty_parts, 3, "-");
+    TEST_ASSERT(result && strcmp(result, "-Hello-") == 0, "ft_strjoin_all empty parts");
+    free(result);
+
+    char bufs[16][9];
+    const char *fragments[16];
+    int ok = 1;
+    srand(test_seed);
+    for (int i = 0; i < 1000 && ok; i++)
+    {
+        size_t count = rand() % 16;
+        char *chained = ft_strdup("");
+        for (size_t j = 0; j < count; j++)
+        {
+            random_string(bufs[j], rand() % 9, "abc");
+            fragments[j] = bufs[j];
+            char *next = ft_strjoin(chained, bufs[j]);
+            free(chained);
+            chained = next;
+        }
+        result = ft_strjoin_all(fragments, count, NULL);
+        ok = result && chained && strcmp(result, chained) == 0;
+        free(result);
+        free(chained);
+    }
+    TEST_ASSERT(ok, "ft_strjoin_all matches chained ft_strjoin on 1000 fuzzed inputs");
+}
+
 void test_ft_strtrim(void)
 {
     printf(BLUE "\n=== Testing ft_strtrim ===\n" RESET);
@@ -355,6 +629,40 @@ void test_ft_strtrim(void)
     free(result);
 }
 
+void test_ft_strtrim_view(void)
+{
+    printf(BLUE "\n=== Testing ft_strtrim_view ===\n" RESET);
+
+    const char *s = "   Hello   ";
+    t_strview view;
+
+    view = ft_strtrim_view(s, " ");
+    TEST_ASSERT(view.ptr == s + 3 && view.len == 5, "ft_strtrim_view spaces");
+
+    view = ft_strtrim_view("abcHelloabc", "abc");
+    TEST_ASSERT(view_equals(view, "Hello"), "ft_strtrim_view multiple chars");
+
+    view = ft_strtrim_view("Hello", "xyz");
+    TEST_ASSERT(view_equals(view, "Hello"), "ft_strtrim_view no trim needed");
+
+    view = ft_strtrim_view("xxxx", "x");
+    TEST_ASSERT(view.len == 0, "ft_strtrim_view everything trimmed");
+
+    char buf[33];
+    char set[5];
+    int ok = 1;
+    srand(test_seed);
+    for (int i = 0; i < 1000 && ok; i++)
+    {
+        random_string(buf, rand() % 33, "ab c");
+        random_string(set, rand() % 5, "ab c");
+        char *expected = ft_strtrim(buf, set);
+        ok = view_equals(ft_strtrim_view(buf, set), expected);
+        free(expected);
+    }
+    TEST_ASSERT(ok, "ft_strtrim_view matches ft_strtrim on 1000 fuzzed inputs");
+}
+
 void test_ft_split(void)
 {
     printf(BLUE "\n=== Testing ft_split ===\n" RESET);
@@ -379,6 +687,58 @@ void test_ft_split(void)
     result = ft_split("", ',');
     TEST_ASSERT(result && result[0] == NULL, "ft_split empty string");
     free_array(result);
+
+    char *text = malloc(4097);
+    int ok = text != NULL;
+    int fuzz_count = profile == PROFILE_SMOKE ? 10 : 100;
+    srand(test_seed);
+    for (int i = 0; i < fuzz_count && ok; i++)
+    {
+        // Full size in soak, so every round does the same amount of work
+        random_string(text, profile == PROFILE_SOAK ? 4096 : rand() % 4097, "abcdefgh   ");
+        ok = split_matches_reference(text, ' ');
+    }
+    free(text);
+    TEST_ASSERT(ok, profile == PROFILE_SMOKE ? "ft_split matches reference on 10 fuzzed inputs up to 4 KiB"
+                                             : "ft_split matches reference on 100 fuzzed inputs up to 4 KiB");
+}
+
+void test_ft_split_iter(void)
+{
+    printf(BLUE "\n=== Testing ft_split_next ===\n" RESET);
+
+    t_split_iter it;
+    const char *s = "  Hello   World  ";
+    const char *token;
+    size_t len;
+
+    ft_split_iter_init(&it, s, ' ');
+    TEST_ASSERT(ft_split_next(&it, &token, &len) && token == s + 2 && len == 5,
+                "ft_split_next first word is a view into the input");
+    TEST_ASSERT(ft_split_next(&it, &token, &len) && token == s + 10 && len == 5,
+                "ft_split_next second word is a view into the input");
+    TEST_ASSERT(!ft_split_next(&it, &token, &len), "ft_split_next stops after last word");
+    TEST_ASSERT(!ft_split_next(&it, &token, &len), "ft_split_next stays exhausted");
+
+    ft_split_iter_init(&it, NULL, ' ');
+    TEST_ASSERT(!ft_split_next(&it, &token, &len), "ft_split_next NULL string yields no words");
+
+    TEST_ASSERT(split_iter_matches_split("Hello,World,42", ','), "ft_split_next matches ft_split basic case");
+    TEST_ASSERT(split_iter_matches_split("   hello   world   ", ' '),
+                "ft_split_next matches ft_split with multiple separators");
+    TEST_ASSERT(split_iter_matches_split("", ','), "ft_split_next matches ft_split empty string");
+    TEST_ASSERT(split_iter_matches_split(",,,,", ','), "ft_split_next matches ft_split only separators");
+    TEST_ASSERT(split_iter_matches_split("Hello", '\0'), "ft_split_next matches ft_split with '\\0' separator");
+
+    char buf[65];
+    int ok = 1;
+    srand(test_seed);
+    for (int i = 0; i < 1000 && ok; i++)
+    {
+        random_string(buf, rand() % 65, "ab,,");
+        ok = split_iter_matches_split(buf, ',');
+    }
+    TEST_ASSERT(ok, "ft_split_next matches ft_split on 1000 fuzzed inputs");
 }
 
 void test_ft_strmapi(void)
@@ -465,6 +825,80 @@ void test_ft_memmove(void)
     strcpy(buffer, "Hello World");
     ft_memmove(buffer, buffer + 2, 5);
     TEST_ASSERT(strncmp(buffer, "llo W", 5) == 0, "ft_memmove overlapping backward");
+
+    // Every overlap distance from -64 to +64 and every length up to 4 KiB,
+    // with the source at every alignment mod 16 (every 127th length in smoke)
+    const long max_dist = 64;
+    const size_t max_len = 4096;
+    const size_t len_step = profile == PROFILE_SMOKE ? 127 : 1;
+    size_t size = max_len + 2 * (max_dist + 2 * MOVE_GUARD);
+    unsigned char *orig = malloc(size);
+    unsigned char *got = malloc(size);
+    unsigned char *want = malloc(size);
+    if (orig && got && want)
+    {
+        srand(test_seed);
+        for (size_t i = 0; i < size; i++)
+            orig[i] = rand();
+        memcpy(got, orig, size);
+        memcpy(want, orig, size);
+        int ok_dst_after = 1;
+        int ok_dst_before = 1;
+        int ok_same = 1;
+        for (long dist = -max_dist; dist <= max_dist; dist++)
+        {
+            for (size_t len = 0; len <= max_len; len += len_step)
+            {
+                size_t src = MOVE_GUARD + max_dist + (len + dist + max_dist) % MOVE_GUARD;
+                int ok = memmove_matches_libc(got, want, orig, src, dist, len);
+                if (!ok && (dist > 0 ? ok_dst_after : dist < 0 ? ok_dst_before : ok_same))
+                    printf(RED "  first mismatch: distance %ld, length %zu" RESET "\n", dist, len);
+                if (dist > 0)
+                    ok_dst_after &= ok;
+                else if (dist < 0)
+                    ok_dst_before &= ok;
+                else
+                    ok_same &= ok;
+            }
+        }
+        TEST_ASSERT(ok_dst_after,
+                    "ft_memmove matches memmove, dst after src (backward copy), distances 1..64, lengths 0..4096");
+        TEST_ASSERT(ok_dst_before,
+                    "ft_memmove matches memmove, dst before src (forward copy), distances -64..-1, lengths 0..4096");
+        TEST_ASSERT(ok_same, "ft_memmove matches memmove with dst == src, lengths 0..4096");
+    }
+    free(orig);
+    free(got);
+    free(want);
+
+    // Multi-MiB moves: overlapping by a few bytes, by most of the block,
+    // and not at all, in both directions
+    if (profile == PROFILE_SMOKE)
+        return;
+    const size_t big_len = (4 << 20) + 3;
+    const long big_dists[] = {1, 7, 4097, (1 << 20) + 5, (4 << 20) + 64};
+    size_t big_src = (5 << 20) + 1;
+    size = big_src + big_len + (5 << 20);
+    orig = malloc(size);
+    got = malloc(size);
+    want = malloc(size);
+    if (orig && got && want)
+    {
+        for (size_t i = 0; i < size; i++)
+            orig[i] = rand();
+        memcpy(got, orig, size);
+        memcpy(want, orig, size);
+        int ok = 1;
+        for (size_t i = 0; i < sizeof(big_dists) / sizeof(big_dists[0]); i++)
+        {
+            ok &= memmove_matches_libc(got, want, orig, big_src, big_dists[i], big_len);
+            ok &= memmove_matches_libc(got, want, orig, big_src, -big_dists[i], big_len);
+        }
+        TEST_ASSERT(ok, "ft_memmove matches memmove on 4 MiB moves in both directions");
+    }
+    free(orig);
+    free(got);
+    free(want);
 }
 
 void test_ft_memchr(void)
@@ -498,6 +932,45 @@ void test_ft_calloc(void)
     char *ptr2 = (char *)ft_calloc(10, sizeof(char));
     TEST_ASSERT(ptr2 != NULL && ptr2[0] == 0 && ptr2[9] == 0, "ft_calloc char array");
     free(ptr2);
+
+    // nmemb * size overflows: must return NULL, not a buffer of the wrapped size
+    // (the buffers are freed so a failure does not also show up as a leak)
+    void *wrapped[4];
+    wrapped[0] = ft_calloc(SIZE_MAX, 2);
+    wrapped[1] = ft_calloc(2, SIZE_MAX);
+    wrapped[2] = ft_calloc(SIZE_MAX / 16 + 2, 16);
+    wrapped[3] = ft_calloc((size_t)1 << (sizeof(size_t) * 4), (size_t)1 << (sizeof(size_t) * 4));
+    TEST_ASSERT(wrapped[0] == NULL, "ft_calloc(SIZE_MAX, 2) overflow returns NULL");
+    TEST_ASSERT(wrapped[1] == NULL, "ft_calloc(2, SIZE_MAX) overflow returns NULL");
+    TEST_ASSERT(wrapped[2] == NULL, "ft_calloc overflow that wraps to 16 bytes returns NULL");
+    TEST_ASSERT(wrapped[3] == NULL, "ft_calloc overflow that wraps to 0 returns NULL");
+    for (int i = 0; i < 4; i++)
+    {
+        if (wrapped[i])
+            free(wrapped[i]);
+    }
+
+    // Zero-size requests: NULL or a unique pointer that can be freed
+    void *zero1 = ft_calloc(0, 8);
+    void *zero2 = ft_calloc(8, 0);
+    void *zero3 = ft_calloc(0, 0);
+    TEST_ASSERT((zero1 == NULL || zero1 != zero2) && (zero2 == NULL || zero2 != zero3) &&
+                    (zero1 == NULL || zero1 != zero3),
+                "ft_calloc zero-size requests return NULL or unique pointers");
+    free(zero1);
+    free(zero2);
+    free(zero3);
+
+    // Large request, too big for the heap (served by mmap in most allocators)
+    if (profile == PROFILE_SMOKE)
+        return;
+    size_t big = (size_t)64 << 20;
+    unsigned char *large = ft_calloc(big / 8, 8);
+    int zeroed = large != NULL;
+    for (size_t i = 0; zeroed && i < big; i++)
+        zeroed = large[i] == 0;
+    TEST_ASSERT(zeroed, "ft_calloc 64 MiB is all zero");
+    free(large);
 }
 
 // =============================================================================
@@ -816,19 +1289,43 @@ void test_ft_lstmap(void)
 
     ft_lstclear(&list, del_content);
     ft_lstclear(&new_list, del_content);
+
+    // Lists of up to 1000 random strings: every node must be a new copy
+    int ok = 1;
+    int fuzz_count = profile == PROFILE_SMOKE ? 2 : 20;
+    srand(test_seed);
+    for (int i = 0; i < fuzz_count && ok; i++)
+    {
+        int size = profile == PROFILE_SOAK ? 999 : rand() % 1000;
+        list = NULL;
+        for (int j = 0; j < size; j++)
+        {
+            size_t len = rand() % 32;
+            char *content = malloc(len + 1);
+            if (content)
+                random_string(content, len, "abcdef");
+            ft_lstadd_front(&list, ft_lstnew(content));
+        }
+        new_list = ft_lstmap(list, duplicate_content, del_content);
+        ok = ft_lstsize(new_list) == size;
+        for (t_list *a = list, *b = new_list; ok && a; a = a->next, b = b->next)
+            ok = b->content != a->content && strcmp(b->content, a->content) == 0;
+        ft_lstclear(&list, del_content);
+        ft_lstclear(&new_list, del_content);
+    }
+    TEST_ASSERT(ok, profile == PROFILE_SMOKE ? "ft_lstmap copies every node of 2 fuzzed lists"
+                                             : "ft_lstmap copies every node of 20 fuzzed lists");
 }
 
 #endif // BONUS_TESTS
 
 // =============================================================================
-// MAIN FUNCTION
+// TEST PROFILES
 // =============================================================================
 
-int main(void)
+// Runs every test function once (full and smoke profiles)
+void run_all_tests(void)
 {
-    printf(YELLOW "=== LIBFT TEST SUITE ===\n" RESET);
-    printf("Testing all libft functions...\n\n");
-
     // Character classification tests
     test_ft_isalpha();
     test_ft_isdigit();
@@ -846,10 +1343,15 @@ int main(void)
     test_ft_strlcpy();
     test_ft_strlcat();
     test_ft_strnstr();
+    test_ft_strnstr_fast();
     test_ft_substr();
+    test_ft_substr_view();
     test_ft_strjoin();
+    test_ft_strjoin_all();
     test_ft_strtrim();
+    test_ft_strtrim_view();
     test_ft_split();
+    test_ft_split_iter();
     test_ft_strmapi();
     test_ft_striteri();
     test_ft_strdup();
@@ -885,12 +1387,181 @@ int main(void)
     test_ft_lstiter();
     test_ft_lstmap();
 #endif
+}
+
+// Tests run in every soak round: the ones that allocate and free the most,
+// on inputs that change with test_seed
+static void (*const soak_tests[])(void) = {
+    test_ft_split,
+    test_ft_split_iter,
+    test_ft_strjoin_all,
+    test_ft_substr_view,
+    test_ft_strtrim_view,
+    test_ft_strnstr_fast,
+#ifdef BONUS_TESTS
+    test_ft_lstmap,
+#endif
+};
+
+// now_seconds and rss_mib are copies of the ones in bench_libft.c; keep
+// them in sync
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Resident set size in MiB, from /proc/self/statm (0 if unavailable)
+static double rss_mib(void)
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    unsigned long size = 0;
+    unsigned long resident = 0;
+
+    if (!statm)
+        return 0;
+    if (fscanf(statm, "%lu %lu", &size, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * (double)sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+// Runs the soak tests in rounds, with a new seed each round, for duration
+// seconds. Test output is discarded; every interval one row is printed with
+// the throughput and RSS, so slowdowns (e.g. allocator fragmentation) and
+// memory growth show up as trends over the run. Throughput is counted in
+// fuzzed input bytes rather than rounds, and the summary compares the first
+// and last quarter of the run rather than single rows, which are noisy.
+int run_soak(double duration)
+{
+    FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+    double interval = duration / 20 < 1 ? 1 : duration / 20;
+    double start = now_seconds();
+    double last = start;
+    double first_rate = 0;
+    double early_rate = 0;
+    double late_start = 0;
+    unsigned long late_bytes = 0;
+    double first_rss = rss_mib();
+    double rate = 0;
+    double rss = first_rss;
+    unsigned long start_bytes = fuzz_bytes;
+    unsigned long last_bytes = fuzz_bytes;
+    int rounds = 0;
+
+    if (!out || !freopen("/dev/null", "w", stdout))
+        return 1;
+    fprintf(out, YELLOW "=== LIBFT SOAK RUN ===\n" RESET);
+    fprintf(out, "%zu test functions per round for %.0f s, one row every %.0f s\n\n",
+            sizeof(soak_tests) / sizeof(soak_tests[0]), duration, interval);
+    fprintf(out, "%8s %10s %12s %10s %10s\n", "Time", "Rounds", "Input MB/s", "RSS MiB", "Speed");
+    while (last - start < duration)
+    {
+        test_seed = ++rounds;
+        for (size_t i = 0; i < sizeof(soak_tests) / sizeof(soak_tests[0]); i++)
+            soak_tests[i]();
+        double now = now_seconds();
+        if (now - last < interval && now - start < duration)
+            continue;
+        // A last row over a fraction of the interval is mostly noise; its
+        // rounds still count in the summary
+        if (now - start >= duration && now - last < interval / 2 && first_rate != 0)
+            break;
+        rate = (fuzz_bytes - last_bytes) / 1e6 / (now - last);
+        rss = rss_mib();
+        if (first_rate == 0)
+            first_rate = rate;
+        if (early_rate == 0 && now - start >= duration / 4)
+            early_rate = (fuzz_bytes - start_bytes) / 1e6 / (now - start);
+        if (late_start == 0 && now - start >= duration * 3 / 4 && now - start < duration)
+        {
+            late_start = now;
+            late_bytes = fuzz_bytes;
+        }
+        fprintf(out, "%7.0fs %10d %12.1f %10.1f %9.1f%%\n",
+                now - start, rounds, rate, rss, 100 * rate / first_rate);
+        fflush(out);
+        last_bytes = fuzz_bytes;
+        last = now;
+    }
+
+    if (late_start == 0)
+    {
+        late_start = start;
+        late_bytes = start_bytes;
+    }
+    if (early_rate == 0)
+        early_rate = (fuzz_bytes - start_bytes) / 1e6 / (now_seconds() - start);
+    double late_rate = (fuzz_bytes - late_bytes) / 1e6 / (now_seconds() - late_start);
+    rss = rss_mib();
+    fprintf(out, YELLOW "\n=== SOAK SUMMARY ===\n" RESET);
+    fprintf(out, "%sThroughput: %.1f MB/s of input in the first quarter, %.1f in the last (%+.1f%%)" RESET "\n",
+            late_rate < early_rate * 0.9 ? YELLOW : GREEN, early_rate, late_rate,
+            100 * (late_rate / early_rate - 1));
+    fprintf(out, "%sRSS: %.1f MiB at start, %.1f MiB at the end (%+.1f MiB)" RESET "\n",
+            rss > first_rss * 1.1 + 1 ? YELLOW : GREEN, first_rss, rss, rss - first_rss);
+    fprintf(out, "Rounds: %d, tests: %d, failed: %d\n", rounds, test_count, test_count - test_passed);
+    if (first_failure)
+        fprintf(out, RED "First failure: %s" RESET "\n", first_failure);
+    fclose(out);
+    return test_passed == test_count ? 0 : 1;
+}
+
+// =============================================================================
+// MAIN FUNCTION
+// =============================================================================
+
+static void print_usage(const char *name)
+{
+    printf("Usage: %s [--profile=full|smoke|soak] [--duration=SECONDS]\n", name);
+    printf("  full   Run every test once (default)\n");
+    printf("  smoke  Run every test once on reduced inputs, for pre-commit hooks\n");
+    printf("  soak   Run the allocation-heavy tests on random inputs for --duration\n");
+    printf("         seconds (default 600), reporting throughput and RSS over time\n");
+}
+
+int main(int argc, char **argv)
+{
+    double duration = 600;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--profile=full") == 0)
+            profile = PROFILE_FULL;
+        else if (strcmp(argv[i], "--profile=smoke") == 0)
+            profile = PROFILE_SMOKE;
+        else if (strcmp(argv[i], "--profile=soak") == 0)
+            profile = PROFILE_SOAK;
+        else if (strncmp(argv[i], "--duration=", 11) == 0 && atof(argv[i] + 11) > 0)
+            duration = atof(argv[i] + 11);
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (profile == PROFILE_SOAK)
+        return run_soak(duration);
+
+    double start = now_seconds();
+    printf(YELLOW "=== LIBFT TEST SUITE ===\n" RESET);
+    printf("Testing all libft functions...\n\n");
+
+    run_all_tests();
 
     // Print summary
     printf(YELLOW "\n=== TEST SUMMARY ===\n" RESET);
     printf("Total tests: %d\n", test_count);
     printf(GREEN "Passed: %d\n" RESET, test_passed);
     printf(RED "Failed: %d\n" RESET, test_count - test_passed);
+    if (profile == PROFILE_SMOKE)
+    {
+        double ms = (now_seconds() - start) * 1e3;
+        printf("%sSmoke run: %.0f ms (budget %d ms)" RESET "\n", ms > SMOKE_BUDGET_MS ? YELLOW : GREEN,
+               ms, SMOKE_BUDGET_MS);
+    }
 
     if (test_passed == test_count)
     {
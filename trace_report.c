@@ -0,0 +1,233 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:00:00 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 14:00:00 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Reads the call statistics written by the instrumented libft (ft_trace.c),
+// either dump files or a live /dev/shm/libft_trace.<pid> region, merges
+// them by function and prints one row per function, most self time first.
+// With --hist=ft_<name>, also prints that function's size and latency
+// histograms.
+
+// Color codes for output
+#define GREEN "\033[32m"
+#define RED "\033[31m"
+#define BLUE "\033[34m"
+#define YELLOW "\033[33m"
+#define RESET "\033[0m"
+
+#define MAX_FUNCS 128
+#define MAX_HIST 16
+
+typedef struct s_report
+{
+    t_trace_func funcs[MAX_FUNCS];
+    int count;
+    uint64_t total_ns;
+} t_report;
+
+// Adds every record of one file to the report; returns 0 on a bad file
+static int read_trace(t_report *report, const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    t_trace_header header;
+    t_trace_func rec;
+    int ok;
+
+    if (!in)
+    {
+        printf(RED "✗ Cannot open %s" RESET "\n", path);
+        return 0;
+    }
+    ok = fread(&header, sizeof(header), 1, in) == 1 &&
+         memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) == 0 &&
+         header.version == TRACE_VERSION && header.buckets == TRACE_BUCKETS;
+    for (uint32_t i = 0; ok && i < header.count; i++)
+    {
+        ok = fread(&rec, sizeof(rec), 1, in) == 1;
+        if (!ok || rec.calls == 0)
+            continue;
+        rec.name[TRACE_NAME_LEN - 1] = '\0';
+        rec.size_arg[TRACE_ARG_LEN - 1] = '\0';
+        int j = 0;
+        while (j < report->count && strcmp(report->funcs[j].name, rec.name) != 0)
+            j++;
+        if (j == report->count)
+        {
+            if (j == MAX_FUNCS)
+                continue;
+            memset(&report->funcs[j], 0, sizeof(rec));
+            memcpy(report->funcs[j].name, rec.name, TRACE_NAME_LEN);
+            memcpy(report->funcs[j].size_arg, rec.size_arg, TRACE_ARG_LEN);
+            report->count++;
+        }
+        t_trace_func *f = &report->funcs[j];
+        f->calls += rec.calls;
+        f->total_ns += rec.total_ns;
+        report->total_ns += rec.total_ns;
+        for (int b = 0; b < TRACE_BUCKETS; b++)
+        {
+            f->size_hist[b] += rec.size_hist[b];
+            f->ns_hist[b] += rec.ns_hist[b];
+        }
+    }
+    fclose(in);
+    if (!ok)
+        printf(RED "✗ %s is not a libft trace (version %d)" RESET "\n", path, TRACE_VERSION);
+    return ok;
+}
+
+// Upper bound of a histogram bucket, e.g. "<4K" for [2K, 4K)
+static const char *bucket_label(int b, char *buf, size_t size)
+{
+    const char *units = " KMG";
+    int shift = b % 10;
+    int unit = b / 10;
+
+    if (b == 0)
+        snprintf(buf, size, "0");
+    else if (b == TRACE_BUCKETS - 1)
+        snprintf(buf, size, ">=%d%c", 1 << ((b - 1) % 10), units[(b - 1) / 10]);
+    else if (unit == 0)
+        snprintf(buf, size, "<%d", 1 << shift);
+    else
+        snprintf(buf, size, "<%d%c", 1 << shift, units[unit]);
+    return buf;
+}
+
+// Bucket holding the given fraction of the calls
+static int percentile(const uint64_t *hist, uint64_t calls, double fraction)
+{
+    uint64_t seen = 0;
+
+    for (int b = 0; b < TRACE_BUCKETS; b++)
+    {
+        seen += hist[b];
+        if (seen >= calls * fraction)
+            return b;
+    }
+    return TRACE_BUCKETS - 1;
+}
+
+static int by_total_time(const void *a, const void *b)
+{
+    const t_trace_func *fa = a;
+    const t_trace_func *fb = b;
+
+    if (fa->total_ns != fb->total_ns)
+        return fa->total_ns < fb->total_ns ? 1 : -1;
+    return fa->calls < fb->calls ? 1 : fa->calls > fb->calls ? -1 : 0;
+}
+
+static void print_table(const t_report *report)
+{
+    char p50[16];
+    char p99[16];
+    char s50[16];
+    char s99[16];
+
+    printf("%-16s %12s %10s %7s %9s %8s %8s   %-8s %-8s %s\n", "Function", "Calls", "Self ms",
+           "Time", "Mean ns", "p50 ns", "p99 ns", "p50 size", "p99 size", "Size of");
+    for (int i = 0; i < report->count; i++)
+    {
+        const t_trace_func *f = &report->funcs[i];
+        int sized = strcmp(f->size_arg, "-") != 0;
+        printf("%-16s %12llu %10.3f %6.1f%% %9.0f %8s %8s   %-8s %-8s %s\n", f->name,
+               (unsigned long long)f->calls, f->total_ns / 1e6,
+               report->total_ns ? 100.0 * f->total_ns / report->total_ns : 0,
+               (double)f->total_ns / f->calls,
+               bucket_label(percentile(f->ns_hist, f->calls, 0.5), p50, sizeof(p50)),
+               bucket_label(percentile(f->ns_hist, f->calls, 0.99), p99, sizeof(p99)),
+               sized ? bucket_label(percentile(f->size_hist, f->calls, 0.5), s50, sizeof(s50)) : "-",
+               sized ? bucket_label(percentile(f->size_hist, f->calls, 0.99), s99, sizeof(s99)) : "-",
+               sized ? f->size_arg : "");
+    }
+}
+
+static void print_hist(const char *title, const uint64_t *hist, uint64_t calls)
+{
+    char label[16];
+
+    printf("  %s\n", title);
+    for (int b = 0; b < TRACE_BUCKETS; b++)
+    {
+        if (hist[b] == 0)
+            continue;
+        int width = (int)(50 * hist[b] / calls);
+        printf("  %8s %12llu %6.1f%% ", bucket_label(b, label, sizeof(label)),
+               (unsigned long long)hist[b], 100.0 * hist[b] / calls);
+        for (int i = 0; i < width; i++)
+            printf("#");
+        printf("\n");
+    }
+}
+
+static void print_histograms(const t_report *report, const char *name)
+{
+    for (int i = 0; i < report->count; i++)
+    {
+        const t_trace_func *f = &report->funcs[i];
+        if (strcmp(f->name, name) != 0)
+            continue;
+        printf(BLUE "\n=== %s: %llu calls ===\n" RESET, f->name, (unsigned long long)f->calls);
+        if (strcmp(f->size_arg, "-") != 0)
+        {
+            char title[64];
+            snprintf(title, sizeof(title), "Size (%s)", f->size_arg);
+            print_hist(title, f->size_hist, f->calls);
+        }
+        print_hist("Latency (ns)", f->ns_hist, f->calls);
+        return;
+    }
+    printf(YELLOW "\n%s was not called" RESET "\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    static t_report report;
+    const char *hist[MAX_HIST];
+    int nhist = 0;
+    int files = 0;
+    int ok = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--hist=", 7) == 0)
+        {
+            if (nhist < MAX_HIST)
+                hist[nhist++] = argv[i] + 7;
+        }
+        else
+        {
+            ok &= read_trace(&report, argv[i]);
+            files++;
+        }
+    }
+    if (files == 0)
+    {
+        printf("Usage: %s [--hist=ft_<name>]... <trace file>...\n", argv[0]);
+        printf("Trace files are written by programs linked with libft_trace.a\n");
+        printf("(or read live from /dev/shm/libft_trace.<pid>)\n");
+        return 1;
+    }
+    qsort(report.funcs, report.count, sizeof(t_trace_func), by_total_time);
+    printf(YELLOW "=== LIBFT TRACE REPORT ===\n" RESET);
+    printf("%d libft functions called, %.3f ms in libft (self time, including tracing overhead)\n\n",
+           report.count, report.total_ns / 1e6);
+    print_table(&report);
+    for (int i = 0; i < nhist; i++)
+        print_histograms(&report, hist[i]);
+    return ok ? 0 : 1;
+}